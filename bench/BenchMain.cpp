@@ -0,0 +1,430 @@
+// FullBodiedBench: offline benchmark / replay harness for the config parser and the timeline runtime.
+//
+//   FullBodiedBench [--data <dir>] [--casters N] [--seconds S] [--fps F] [--trace <file>]
+//                   [--parse-runs K] [--seed X] [--scrub S]
+//
+// Loads the INI and timeline packs from <dir>/Data (the same relative paths the plugin uses from the
+// game folder), starts a timeline on each of N caster/target pairs (timelines assigned round robin,
+// restarted as they finish), and steps FB::ActorManager::Update through S simulated seconds of frame
+// times: a synthetic F fps trace with jitter and hitches, or --trace (one dt in seconds per line,
+// '#' comments, looped). With --scrub, every S simulated seconds each running timeline is sought back
+// to half its elapsed time (FB::ActorManager::SeekTimeline), the way a scrubbed or re-synced clip
+// would. Effects go to the mock backend (MockBackend.h).
+
+#include "MockBackend.h"
+
+#include "ActorManager.h"
+#include "FBActorRegistry.h"
+#include "FBConfig.h"
+#include "FBFrameClock.h"
+#include "FBScaler.h"
+#include "FBScheduler.h"
+#include "FBStats.h"
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Allocation counter: every operator new in the process goes through here.
+namespace
+{
+	std::atomic<std::uint64_t> g_allocations{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+#if defined(_MSC_VER)
+	void* p = _aligned_malloc(size ? size : 1, static_cast<std::size_t>(align));
+#else
+	const auto alignment = static_cast<std::size_t>(align);
+	void* p = std::aligned_alloc(alignment, ((size ? size : 1) + alignment - 1) / alignment * alignment);
+#endif
+	if (p) {
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+#if defined(_MSC_VER)
+void operator delete(void* p, std::align_val_t) noexcept { _aligned_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		std::filesystem::path dataRoot{ "." };
+		std::uint32_t casters{ 64 };
+		float seconds{ 60.0f };
+		float fps{ 60.0f };
+		std::filesystem::path trace;
+		std::uint32_t parseRuns{ 5 };
+		std::uint32_t seed{ 1 };
+		float scrubSeconds{ 0.0f };  // 0 = no seeks
+	};
+
+	// One caster/target pair: its timeline restarts every period seconds.
+	struct Pair
+	{
+		RE::ActorHandle caster;
+		RE::ActorHandle target;
+		FB::ActorRegistry::Slot slot;
+		FB::TimelinePtr timeline;
+
+		float period{ 0.0f };
+		float nextStart{ 0.0f };
+		float runStart{ 0.0f };
+		bool running{ false };
+	};
+
+	// Deterministic xorshift, so two runs with the same seed replay the same scene and trace.
+	struct Random
+	{
+		std::uint32_t state;
+
+		float Next()
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+		}
+	};
+
+	static double Micros(Clock::duration d)
+	{
+		return std::chrono::duration<double, std::micro>(d).count();
+	}
+
+	static double Percentile(std::vector<double>& v, double p)
+	{
+		if (v.empty()) {
+			return 0.0;
+		}
+		const auto k = static_cast<std::size_t>(p * static_cast<double>(v.size() - 1));
+		std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end());
+		return v[k];
+	}
+
+	template <class T>
+	static bool ParseNumber(std::string_view s, T& out)
+	{
+		const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+		return ec == std::errc() && ptr == s.data() + s.size();
+	}
+
+	static bool ParseArgs(int argc, char** argv, Options& opt)
+	{
+		for (int i = 1; i < argc; ++i) {
+			const std::string_view arg = argv[i];
+			const bool hasValue = i + 1 < argc;
+			const std::string_view value = hasValue ? argv[i + 1] : std::string_view{};
+
+			bool ok = hasValue;
+			if (arg == "--data" && hasValue) {
+				opt.dataRoot = value;
+			}
+			else if (arg == "--casters") {
+				ok = ok && ParseNumber(value, opt.casters) && opt.casters > 0;
+			}
+			else if (arg == "--seconds") {
+				ok = ok && ParseNumber(value, opt.seconds) && opt.seconds > 0.0f;
+			}
+			else if (arg == "--fps") {
+				ok = ok && ParseNumber(value, opt.fps) && opt.fps > 0.0f;
+			}
+			else if (arg == "--trace" && hasValue) {
+				opt.trace = value;
+			}
+			else if (arg == "--parse-runs") {
+				ok = ok && ParseNumber(value, opt.parseRuns) && opt.parseRuns > 0;
+			}
+			else if (arg == "--seed") {
+				ok = ok && ParseNumber(value, opt.seed) && opt.seed != 0;
+			}
+			else if (arg == "--scrub") {
+				ok = ok && ParseNumber(value, opt.scrubSeconds) && opt.scrubSeconds > 0.0f;
+			}
+			else {
+				ok = false;
+			}
+
+			if (!ok) {
+				std::cerr << std::format("bad argument '{}'\n", arg);
+				return false;
+			}
+			++i;
+		}
+
+		// Casters and targets each take a registry slot
+		opt.casters = std::min<std::uint32_t>(opt.casters, FB::ActorRegistry::kCapacity / 2);
+		return true;
+	}
+
+	static std::vector<float> LoadTrace(const std::filesystem::path& path)
+	{
+		std::vector<float> dts;
+		std::ifstream in(path);
+		for (std::string line; std::getline(in, line); ) {
+			std::string_view s = line;
+			s = s.substr(0, s.find('#'));
+			while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+				s.remove_prefix(1);
+			}
+			while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) {
+				s.remove_suffix(1);
+			}
+
+			float dt = 0.0f;
+			if (!s.empty() && ParseNumber(s, dt) && dt > 0.0f) {
+				dts.push_back(dt);
+			}
+		}
+		return dts;
+	}
+
+	// Synthetic frame times: fps with +-10% jitter and a 100ms hitch roughly every 10 seconds.
+	static std::vector<float> SyntheticTrace(const Options& opt, Random& rng)
+	{
+		const float frame = 1.0f / opt.fps;
+		const auto frames = static_cast<std::size_t>(std::ceil(opt.seconds * opt.fps));
+
+		std::vector<float> dts;
+		dts.reserve(frames);
+		for (std::size_t i = 0; i < frames; ++i) {
+			const bool hitch = rng.Next() < 1.0f / (10.0f * opt.fps);
+			dts.push_back(hitch ? 0.1f : frame * (0.9f + 0.2f * rng.Next()));
+		}
+		return dts;
+	}
+
+	// Every timeline in the snapshot, compiling lazy ones; sorted by name for a stable assignment.
+	static std::vector<FB::TimelinePtr> CollectTimelines(const FB::Config::ConfigData& cfg)
+	{
+		std::vector<std::pair<std::string, FB::TimelinePtr>> named;
+		for (const auto& [name, timeline] : cfg.timelines) {
+			named.emplace_back(name, timeline);
+		}
+		for (const auto& [name, lazy] : cfg.lazyTimelines) {
+			named.emplace_back(name, lazy->Get());
+		}
+		std::ranges::sort(named, {}, &std::pair<std::string, FB::TimelinePtr>::first);
+
+		std::vector<FB::TimelinePtr> out;
+		for (auto& [name, timeline] : named) {
+			if (timeline && !timeline->Empty()) {
+				out.push_back(std::move(timeline));
+			}
+		}
+		return out;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options opt;
+	if (!ParseArgs(argc, argv, opt)) {
+		std::cerr << "usage: FullBodiedBench [--data <dir>] [--casters N] [--seconds S] [--fps F] [--trace <file>] [--parse-runs K] [--seed X] [--scrub S]\n";
+		return 2;
+	}
+
+	// The plugin resolves Data/... against the game folder; the bench against --data.
+	std::error_code ec;
+	std::filesystem::current_path(opt.dataRoot, ec);
+	if (ec) {
+		std::cerr << std::format("cannot enter '{}': {}\n", opt.dataRoot.string(), ec.message());
+		return 2;
+	}
+
+	// Parser diagnostics (warnings and up) to stderr; the report below goes to stdout.
+	spdlog::set_default_logger(spdlog::stderr_color_mt("bench"));
+	spdlog::set_level(spdlog::level::warn);
+
+	// 1) Parse: the first run may miss the .fbcache (and writes it), later runs show the cached path.
+	std::vector<double> parseUs;
+	for (std::uint32_t run = 0; run < opt.parseRuns; ++run) {
+		const auto start = Clock::now();
+		FB::Config::Reload(&FB::Scaler::ResolveNodeKey);
+		parseUs.push_back(Micros(Clock::now() - start));
+	}
+
+	const auto cfg = FB::Config::Get(nullptr);
+	const auto compileStart = Clock::now();
+	const auto timelines = CollectTimelines(*cfg);
+	const double compileUs = Micros(Clock::now() - compileStart);
+
+	if (timelines.empty()) {
+		std::cerr << std::format("no timelines with commands under '{}'\n", std::filesystem::current_path().string());
+		return 1;
+	}
+
+	std::size_t commandTotal = 0;
+	for (const auto& timeline : timelines) {
+		commandTotal += timeline->CommandCount();
+	}
+
+	// 2) Scene: pairs scattered around the camera (origin) out to beyond the LOD cull distance.
+	Random rng{ opt.seed };
+	const float maxDistance = std::max({ cfg->lod.farDistance, cfg->lod.cullDistance, 1024.0f }) * 1.25f;
+
+	std::vector<Pair> pairs(opt.casters);
+	for (std::uint32_t i = 0; i < opt.casters; ++i) {
+		const float angle = rng.Next() * 6.2831853f;
+		const float distance = 64.0f + rng.Next() * maxDistance;
+		const RE::NiPoint3 pos{ std::cos(angle) * distance, std::sin(angle) * distance, 0.0f };
+
+		const std::uint32_t casterID = 0xFB000000u + 2 * i;
+		auto& pair = pairs[i];
+		pair.caster = FB::Bench::AddActor(casterID, std::format("caster{}", i), pos);
+		pair.target = FB::Bench::AddActor(casterID + 1, std::format("target{}", i), { pos.x + 60.0f, pos.y, pos.z });
+		pair.slot = FB::ActorRegistry::Acquire(casterID);
+		(void)FB::ActorRegistry::Acquire(casterID + 1);
+
+		pair.timeline = timelines[i % timelines.size()];
+		pair.period = pair.timeline->order.back().timeSeconds + 0.5f;
+		pair.nextStart = rng.Next() * pair.period;
+	}
+
+	std::vector<float> dts = opt.trace.empty() ? SyntheticTrace(opt, rng) : LoadTrace(opt.trace);
+	if (dts.empty()) {
+		std::cerr << std::format("no frame times in '{}'\n", opt.trace.string());
+		return 1;
+	}
+
+	// 3) Run
+	std::vector<double> tickUs;
+	std::vector<std::uint64_t> tickAllocs;
+	tickUs.reserve(static_cast<std::size_t>(opt.seconds * 240.0f));
+	tickAllocs.reserve(tickUs.capacity());
+
+	std::uint64_t starts = 0;
+	std::uint64_t seeks = 0;
+	std::uint64_t commandsExecuted = 0;
+	double simSeconds = 0.0;
+	double nextScrub = opt.scrubSeconds;
+
+	for (std::size_t frame = 0; simSeconds < opt.seconds; ++frame) {
+		const float dt = dts[frame % dts.size()];
+		simSeconds += dt;
+
+		// Starts come from the animation event sink in game; they are not part of the tick cost.
+		for (auto& pair : pairs) {
+			if (static_cast<float>(simSeconds) < pair.nextStart) {
+				continue;
+			}
+			if (pair.running) {
+				commandsExecuted += pair.timeline->CommandCount();  // the previous run finished
+			}
+			FB::ActorManager::StartTimeline(pair.caster, pair.target, pair.slot, pair.timeline, false);
+			pair.running = true;
+			pair.runStart = static_cast<float>(simSeconds);
+			pair.nextStart += pair.period;
+			++starts;
+		}
+
+		// Scrubs are game-thread calls between ticks, like starts not part of the tick cost. A pair's
+		// schedule moves with its clock, so commandsExecuted keeps counting commands passed.
+		if (opt.scrubSeconds > 0.0f && simSeconds >= nextScrub) {
+			nextScrub += opt.scrubSeconds;
+			for (auto& pair : pairs) {
+				const float elapsed = static_cast<float>(simSeconds) - pair.runStart;
+				if (pair.running && FB::ActorManager::SeekTimeline(pair.slot, elapsed * 0.5f, false)) {
+					pair.runStart += elapsed * 0.5f;
+					pair.nextStart += elapsed * 0.5f;
+					++seeks;
+				}
+			}
+		}
+
+		const auto allocsBefore = g_allocations.load(std::memory_order_relaxed);
+		const auto start = Clock::now();
+
+		FB::FrameClock::Advance(std::min(dt, 0.25f));
+		FB::Scheduler::BeginFrame();
+		FB::ActorManager::Update(dt);
+
+		tickUs.push_back(Micros(Clock::now() - start));
+		tickAllocs.push_back(g_allocations.load(std::memory_order_relaxed) - allocsBefore);
+	}
+
+	// Runs still in flight: the commands their clock has passed
+	for (const auto& pair : pairs) {
+		if (!pair.running) {
+			continue;
+		}
+		const auto& order = pair.timeline->order;
+		const float t = static_cast<float>(simSeconds) - pair.runStart;
+		commandsExecuted += static_cast<std::uint64_t>(std::ranges::upper_bound(order, t, {}, &FB::CommandRef::timeSeconds) - order.begin());
+	}
+
+	// 4) Report
+	double tickTotalUs = 0.0;
+	for (const double us : tickUs) {
+		tickTotalUs += us;
+	}
+	std::uint64_t allocTotal = 0;
+	for (const auto n : tickAllocs) {
+		allocTotal += n;
+	}
+	const auto ticks = tickUs.size();
+	const double maxTickUs = *std::ranges::max_element(tickUs);
+
+	std::cout << std::format("config: timelines={} commands={} packs={} lazy={}\n",
+		timelines.size(), commandTotal, cfg->packSources.size(), cfg->lazyCompile);
+	std::cout << std::format("parse: runs={} first={:.1f}us min={:.1f}us p50={:.1f}us lazyCompile={:.1f}us\n",
+		parseUs.size(), parseUs.front(), *std::ranges::min_element(parseUs), Percentile(parseUs, 0.50), compileUs);
+	std::cout << std::format("sim: casters={} ticks={} simSeconds={:.1f} trace={} budgetUs={}\n",
+		opt.casters, ticks, simSeconds, opt.trace.empty() ? std::format("synthetic@{}fps", opt.fps) : opt.trace.string(),
+		cfg->frameBudgetMicros);
+	std::cout << std::format("tick: mean={:.2f}us p50={:.2f}us p99={:.2f}us max={:.2f}us\n",
+		tickTotalUs / static_cast<double>(ticks), Percentile(tickUs, 0.50), Percentile(tickUs, 0.99), maxTickUs);
+	std::cout << std::format("allocs: perTick={:.3f} max={} total={}\n",
+		static_cast<double>(allocTotal) / static_cast<double>(ticks), *std::ranges::max_element(tickAllocs), allocTotal);
+	std::cout << std::format("commands: starts={} seeks={} executed={} perSimSecond={:.0f} perUpdateSecond={:.0f}\n",
+		starts, seeks, commandsExecuted, static_cast<double>(commandsExecuted) / simSeconds,
+		tickTotalUs > 0.0 ? static_cast<double>(commandsExecuted) / (tickTotalUs / 1'000'000.0) : 0.0);
+
+	const auto& counters = FB::Bench::Counters();
+	std::cout << std::format("backend: scaleWrites={} scaleFlushes={} morphWrites={} morphFlushes={} morphResets={} hideOps={}\n",
+		counters.scaleWrites, counters.scaleFlushes, counters.morphWrites, counters.morphFlushes, counters.morphResets, counters.hideOps);
+
+	for (const auto& line : FB::Stats::Summarize()) {
+		std::cout << std::format("stats: {}\n", line);
+	}
+
+	return 0;
+}
@@ -0,0 +1,170 @@
+#include "MockBackend.h"
+
+#include "FBClipTime.h"
+#include "FBHide.h"
+#include "FBMorph.h"
+#include "FBMorphWriter.h"
+#include "FBScaler.h"
+
+#include <array>
+#include <bit>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	struct ActorEntry
+	{
+		RE::Actor actor;
+		std::array<float, FB::Scaler::kNodeCount> scales{};
+	};
+
+	// Handle value = index + 1 (0 stays the null handle). A deque never moves its elements,
+	// so the Actor* behind a handle stays valid while actors are added.
+	std::deque<ActorEntry> g_actors;
+
+	RE::PlayerCamera g_camera;
+	RE::NiNode g_cameraRoot;
+
+	FB::Bench::BackendCounters g_counters;
+
+	// BSFixedString pool: node-based, so interned pointers stay valid as it grows
+	std::mutex g_stringMutex;
+	std::unordered_set<std::string> g_strings;
+
+	static ActorEntry* FindEntry(RE::ActorHandle actor)
+	{
+		const auto native = actor.native_handle();
+		return native != 0 && native <= g_actors.size() ? std::addressof(g_actors[native - 1]) : nullptr;
+	}
+}
+
+namespace RE
+{
+	const char* InternFixedString(const char* str)
+	{
+		if (!str || *str == '\0') {
+			return "";
+		}
+
+		std::lock_guard _{ g_stringMutex };
+		return g_strings.emplace(str).first->c_str();
+	}
+
+	Actor* LookupActorHandle(std::uint32_t native) noexcept
+	{
+		return native != 0 && native <= g_actors.size() ? std::addressof(g_actors[native - 1].actor) : nullptr;
+	}
+
+	PlayerCamera* PlayerCamera::GetSingleton() noexcept
+	{
+		g_camera.cameraRoot = std::addressof(g_cameraRoot);
+		return std::addressof(g_camera);
+	}
+}
+
+namespace FB::Bench
+{
+	RE::ActorHandle AddActor(std::uint32_t formID, std::string name, const RE::NiPoint3& position)
+	{
+		auto& entry = g_actors.emplace_back();
+		entry.actor.formID = formID;
+		entry.actor.name = std::move(name);
+		entry.actor.position = position;
+		entry.scales.fill(1.0f);
+		return RE::ActorHandle{ static_cast<std::uint32_t>(g_actors.size()) };
+	}
+
+	const BackendCounters& Counters()
+	{
+		return g_counters;
+	}
+}
+
+namespace FB::Scaler
+{
+	// The plugin posts one SKSE task per actor here; the bench applies to the actor table inline.
+	void PostBatchWrites(const Batch::ActorWrites& writes)
+	{
+		auto* entry = FindEntry(writes.actor);
+		if (!entry) {
+			return;
+		}
+
+		++g_counters.scaleFlushes;
+		for (auto bits = writes.mask; bits != 0; bits &= bits - 1) {
+			const auto idx = static_cast<std::size_t>(std::countr_zero(bits));
+			entry->scales[idx] = writes.scales[idx];
+			++g_counters.scaleWrites;
+		}
+	}
+
+	std::optional<float> GetNodeScale(RE::ActorHandle actor, NodeId id)
+	{
+		const auto* entry = FindEntry(actor);
+		return entry ? std::optional<float>(entry->scales[static_cast<std::size_t>(id)]) : std::nullopt;
+	}
+}
+
+namespace FB::Morph
+{
+	// Stand-ins for FBMorphWriter.cpp: FBMorph.cpp's values, sticky scheduler and per-actor batching
+	// are the real ones, only the RaceMenu / Papyrus call at the end is counted instead of made.
+	void WriteMorphs(
+		RE::Actor* actor,
+		const std::vector<RE::BSFixedString>& morphNames,
+		const std::vector<float>& /*values*/,
+		bool /*logOps*/)
+	{
+		if (actor) {
+			++g_counters.morphFlushes;
+			g_counters.morphWrites += morphNames.size();
+		}
+	}
+
+	void ClearMorphs(RE::Actor* actor, bool /*logOps*/)
+	{
+		if (actor) {
+			++g_counters.morphResets;
+		}
+	}
+
+	void SetNativeEnabled(bool /*enabled*/) {}
+}
+
+namespace FB::Hide
+{
+	// Counted only: the plugin hides geometry under the root, which must not read as a culled actor.
+	void ApplyHide(RE::ActorHandle actor, bool /*hide*/, bool /*logOps*/)
+	{
+		if (FindEntry(actor)) {
+			++g_counters.hideOps;
+		}
+	}
+
+	void ApplyHideSlot(RE::ActorHandle actor, std::uint16_t /*slotNumber*/, bool /*hide*/, bool /*logOps*/)
+	{
+		if (FindEntry(actor)) {
+			++g_counters.hideOps;
+		}
+	}
+
+	void ResetActor(RE::ActorHandle actor, bool /*logOps*/)
+	{
+		if (FindEntry(actor)) {
+			++g_counters.hideOps;
+		}
+	}
+}
+
+namespace FB::ClipTime
+{
+	// No behavior graphs offline: synced timelines fall back to frame time, as in game when the clip is missing.
+	std::optional<float> Sample(RE::Actor* /*actor*/, std::string_view /*clipName*/)
+	{
+		return std::nullopt;
+	}
+}
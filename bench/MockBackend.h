@@ -0,0 +1,29 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <cstdint>
+#include <string>
+
+namespace FB::Bench
+{
+	// Mock effect backend: FullBodiedBench links this in place of FBScaler.cpp / FBMorphWriter.cpp /
+	// FBHide.cpp / FBClipTime.cpp. Writes land in an in-process actor table and are counted; nothing
+	// is posted to SKSE or RaceMenu. The timeline runtime, config parser, Scaler::Batch
+	// (FBScalerBatch.cpp) and the morph store and sticky scheduler (FBMorph.cpp) above it are the real ones.
+
+	struct BackendCounters
+	{
+		std::uint64_t scaleWrites{ 0 };    // node writes applied by Scaler::Batch::Flush
+		std::uint64_t scaleFlushes{ 0 };   // per-actor batches (one SKSE task each in the plugin)
+		std::uint64_t morphWrites{ 0 };    // morph values sent by Morph::FlushPending (incl. sticky re-applies)
+		std::uint64_t morphFlushes{ 0 };   // per-actor SetMorphs calls (one UpdateModelWeight each)
+		std::uint64_t morphResets{ 0 };    // per-actor ClearMorphs calls
+		std::uint64_t hideOps{ 0 };        // Hide::ApplyHide / ApplyHideSlot / ResetActor calls
+	};
+
+	// Add an actor to the table and return its handle. Set up before the run (not thread-safe).
+	RE::ActorHandle AddActor(std::uint32_t formID, std::string name, const RE::NiPoint3& position);
+
+	const BackendCounters& Counters();
+}
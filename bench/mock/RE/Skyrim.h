@@ -0,0 +1,152 @@
+#pragma once
+
+// Bench stand-in for CommonLibSSE's RE/Skyrim.h: just the engine types the config parser and the
+// timeline runtime touch, backed by an in-process actor table (MockBackend.cpp) instead of the game.
+// Only what FullBodiedBench compiles needs to exist here; keep the names and call shapes identical
+// to CommonLibSSE so the plugin sources build unchanged.
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace RE
+{
+	template <class E>
+	class EnumSet
+	{
+	public:
+		using underlying_type = std::underlying_type_t<E>;
+
+		bool any(E flag) const noexcept { return (_value & static_cast<underlying_type>(flag)) != 0; }
+		void set(E flag) noexcept { _value |= static_cast<underlying_type>(flag); }
+		void reset(E flag) noexcept { _value &= ~static_cast<underlying_type>(flag); }
+
+	private:
+		underlying_type _value{ 0 };
+	};
+
+	// Defined by the bench backend: the pooled copy of a string (stable for the whole run).
+	const char* InternFixedString(const char* str);
+
+	// Pooled like the game's: construction interns, copies only copy the pointer.
+	class BSFixedString
+	{
+	public:
+		BSFixedString() = default;
+		BSFixedString(const char* str) :
+			_data(InternFixedString(str)) {}
+
+		const char* c_str() const noexcept { return _data; }
+		const char* data() const noexcept { return _data; }
+		bool empty() const noexcept { return *_data == '\0'; }
+		bool operator==(const BSFixedString& other) const noexcept { return _data == other._data; }
+
+	private:
+		const char* _data{ "" };
+	};
+
+	// Non-owning here: every object the bench hands out lives in its actor table for the whole run.
+	template <class T>
+	class NiPointer
+	{
+	public:
+		NiPointer() = default;
+		NiPointer(T* ptr) noexcept :
+			_ptr(ptr) {}
+
+		T* get() const noexcept { return _ptr; }
+		T* operator->() const noexcept { return _ptr; }
+		T& operator*() const noexcept { return *_ptr; }
+		explicit operator bool() const noexcept { return _ptr != nullptr; }
+
+	private:
+		T* _ptr{ nullptr };
+	};
+
+	struct NiPoint3
+	{
+		float x{ 0.0f };
+		float y{ 0.0f };
+		float z{ 0.0f };
+
+		NiPoint3 operator-(const NiPoint3& other) const noexcept { return { x - other.x, y - other.y, z - other.z }; }
+		float SqrLength() const noexcept { return x * x + y * y + z * z; }
+	};
+
+	struct NiTransform
+	{
+		NiPoint3 translate;
+		float scale{ 1.0f };
+	};
+
+	class NiAVObject
+	{
+	public:
+		enum class Flag : std::uint32_t
+		{
+			kNone = 0,
+			kHidden = 1u << 0,
+		};
+
+		virtual ~NiAVObject() = default;
+
+		EnumSet<Flag>& GetFlags() noexcept { return flags; }
+		const EnumSet<Flag>& GetFlags() const noexcept { return flags; }
+
+		NiTransform local;
+		NiTransform world;
+		EnumSet<Flag> flags;
+	};
+
+	class NiNode : public NiAVObject
+	{
+	};
+
+	class Actor
+	{
+	public:
+		std::uint32_t GetFormID() const noexcept { return formID; }
+		const char* GetName() const noexcept { return name.c_str(); }
+		NiPoint3 GetPosition() const noexcept { return position; }
+
+		bool IsDisabled() const noexcept { return disabled; }
+		bool Is3DLoaded() const noexcept { return loaded; }
+		NiAVObject* Get3D() const noexcept { return loaded ? const_cast<NiNode*>(&root) : nullptr; }
+
+		std::uint32_t formID{ 0 };
+		std::string name;
+		NiPoint3 position;
+		bool disabled{ false };
+		bool loaded{ true };
+		NiNode root;
+	};
+
+	// Defined by the bench backend: the actor behind a handle value (nullptr if none).
+	Actor* LookupActorHandle(std::uint32_t native) noexcept;
+
+	class ActorHandle
+	{
+	public:
+		ActorHandle() = default;
+		explicit ActorHandle(std::uint32_t native) noexcept :
+			_native(native) {}
+
+		NiPointer<Actor> get() const noexcept { return LookupActorHandle(_native); }
+		std::uint32_t native_handle() const noexcept { return _native; }
+
+		explicit operator bool() const noexcept { return _native != 0; }
+		bool operator==(const ActorHandle&) const noexcept = default;
+
+	private:
+		std::uint32_t _native{ 0 };
+	};
+
+	class PlayerCamera
+	{
+	public:
+		// Defined by the bench backend: a fixed camera at the world origin.
+		static PlayerCamera* GetSingleton() noexcept;
+
+		NiPointer<NiNode> cameraRoot;
+	};
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Bench stand-in for CommonLibSSE's SKSE/SKSE.h. The sources FullBodiedBench compiles do not use
+// any SKSE API; this only satisfies PCH.h.
@@ -1,118 +1,212 @@
 #include "ActorManager.h"
 
+#include "FBActorRegistry.h"
+#include "FBClipTime.h"
 #include "FBScaler.h"
 #include "FBMorph.h"
 #include "FBHide.h"
+#include "FBScheduler.h"
+#include "FBStats.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <cassert>
 
 namespace
 {
-    struct ActorRuntimeState
+    // Per-caster ownership state, one per registry slot. The array never moves, so a CasterState*
+    // stays valid for the process lifetime and running work can check its token without a lookup or a lock.
+    struct CasterState
     {
-        std::uint64_t token{ 0 };
+        // Bumped on every start/cancel (and when the slot changes hands); timelines and tweens hold
+        // the value they were started with.
+        std::atomic<std::uint64_t> generation{ 0 };
+
+        // Guarded by g_stateMutex
+        std::uint32_t registryGeneration{ 0 };  // registry slot generation this state belongs to
         RE::ActorHandle lastTarget{};
 
-        std::unordered_set<std::string_view> casterTouchedScale;
-        std::unordered_set<std::string_view> targetTouchedScale;
+        // Bit i => FB::Scaler::NodeId(i) was written for that role
+        std::uint32_t casterTouchedScale{ 0 };
+        std::uint32_t targetTouchedScale{ 0 };
 
         bool casterTouchedMorph{ false };
         bool targetTouchedMorph{ false };
     };
 
+    // A caster slot plus the generation a piece of work belongs to.
+    struct OwnerToken
+    {
+        CasterState* slot{ nullptr };
+        std::uint64_t generation{ 0 };
+
+        bool IsCurrent() const noexcept
+        {
+            return slot && slot->generation.load(std::memory_order_acquire) == generation;
+        }
+    };
+
     std::mutex g_stateMutex;
-    std::unordered_map<std::uint32_t, ActorRuntimeState> g_state;
+    std::array<CasterState, FB::ActorRegistry::kCapacity> g_casters;
+
+    // Caller holds g_stateMutex. A slot reissued to another actor starts clean, and its token
+    // generation moves on so work still owned by the previous holder stops.
+    static CasterState& GetStateLocked(FB::ActorRegistry::Slot casterSlot)
+    {
+        auto& st = g_casters[casterSlot.index];
+        if (st.registryGeneration != casterSlot.generation) {
+            st.registryGeneration = casterSlot.generation;
+            st.lastTarget = {};
+            st.casterTouchedScale = 0;
+            st.targetTouchedScale = 0;
+            st.casterTouchedMorph = false;
+            st.targetTouchedMorph = false;
+            st.generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+        return st;
+    }
 
-    static std::uint64_t BumpToken(std::uint32_t casterFormID)
+    static OwnerToken BumpToken(FB::ActorRegistry::Slot casterSlot)
     {
         std::lock_guard _{ g_stateMutex };
-        auto& st = g_state[casterFormID];
-        ++st.token;
+        auto& st = GetStateLocked(casterSlot);
 
-        st.casterTouchedScale.clear();
-        st.targetTouchedScale.clear();
+        st.casterTouchedScale = 0;
+        st.targetTouchedScale = 0;
         st.casterTouchedMorph = false;
         st.targetTouchedMorph = false;
 
-        return st.token;
+        const auto generation = st.generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+        return { std::addressof(st), generation };
     }
 
-    static bool IsTokenCurrent(std::uint32_t casterFormID, std::uint64_t token)
+    static void SetLastTarget(FB::ActorRegistry::Slot casterSlot, RE::ActorHandle target)
     {
         std::lock_guard _{ g_stateMutex };
-        auto it = g_state.find(casterFormID);
-        return it != g_state.end() && it->second.token == token;
+        GetStateLocked(casterSlot).lastTarget = target;
     }
 
-    static void SetLastTarget(std::uint32_t casterFormID, RE::ActorHandle target)
+    static RE::ActorHandle GetLastTarget(FB::ActorRegistry::Slot casterSlot)
     {
         std::lock_guard _{ g_stateMutex };
-        g_state[casterFormID].lastTarget = target;
+        return GetStateLocked(casterSlot).lastTarget;
     }
 
-    static RE::ActorHandle GetLastTarget(std::uint32_t casterFormID)
+    static_assert(FB::Scaler::kNodeCount <= 32, "touched-scale bitsets hold one bit per NodeId");
+
+    static constexpr std::uint32_t NodeBit(FB::Scaler::NodeId node)
     {
-        std::lock_guard _{ g_stateMutex };
-        auto it = g_state.find(casterFormID);
-        return it == g_state.end() ? RE::ActorHandle{} : it->second.lastTarget;
+        return 1u << static_cast<std::uint32_t>(node);
     }
 
-    static void MarkTouchedScale(std::uint32_t casterFormID, FB::TargetKind who, std::string_view nodeKey)
+    // Touched state gathered during one Update tick and committed under a single lock at the end.
+    // Game thread only (Update and the inbox drain), so the buffer is always empty between ticks.
+    struct TouchedDelta
     {
-        std::lock_guard _{ g_stateMutex };
-        auto& st = g_state[casterFormID];
+        OwnerToken owner;
+        std::uint32_t casterScale{ 0 };
+        std::uint32_t targetScale{ 0 };
+        bool casterMorph{ false };
+        bool targetMorph{ false };
+    };
+
+    static std::vector<TouchedDelta> g_tickTouched;
+
+    static TouchedDelta& TouchedFor(const OwnerToken& owner)
+    {
+        for (auto& d : g_tickTouched) {
+            if (d.owner.slot == owner.slot && d.owner.generation == owner.generation) {
+                return d;
+            }
+        }
+
+        auto& d = g_tickTouched.emplace_back();
+        d.owner = owner;
+        return d;
+    }
+
+    static void MarkTouchedScale(const OwnerToken& owner, FB::TargetKind who, FB::Scaler::NodeId node)
+    {
+        auto& d = TouchedFor(owner);
         if (who == FB::TargetKind::kCaster) {
-            st.casterTouchedScale.insert(nodeKey);
+            d.casterScale |= NodeBit(node);
         }
         else {
-            st.targetTouchedScale.insert(nodeKey);
+            d.targetScale |= NodeBit(node);
         }
     }
 
-    static void MarkTouchedMorph(std::uint32_t casterFormID, FB::TargetKind who)
+    static void MarkTouchedMorph(const OwnerToken& owner, FB::TargetKind who)
     {
-        std::lock_guard _{ g_stateMutex };
-        auto& st = g_state[casterFormID];
+        auto& d = TouchedFor(owner);
         if (who == FB::TargetKind::kCaster) {
-            st.casterTouchedMorph = true;
+            d.casterMorph = true;
         }
         else {
-            st.targetTouchedMorph = true;
+            d.targetMorph = true;
+        }
+    }
+
+    static void CommitTouched()
+    {
+        if (g_tickTouched.empty()) {
+            return;
+        }
+
+        {
+            std::lock_guard _{ g_stateMutex };
+            for (const auto& d : g_tickTouched) {
+                auto& st = *d.owner.slot;
+
+                // A reset since the write already snapshotted this lineage; its bits no longer apply.
+                if (st.generation.load(std::memory_order_relaxed) != d.owner.generation) {
+                    continue;
+                }
+
+                st.casterTouchedScale |= d.casterScale;
+                st.targetTouchedScale |= d.targetScale;
+                st.casterTouchedMorph = st.casterTouchedMorph || d.casterMorph;
+                st.targetTouchedMorph = st.targetTouchedMorph || d.targetMorph;
+            }
         }
+
+        g_tickTouched.clear();
     }
 
     struct ResetSnapshot
     {
         RE::ActorHandle lastTarget{};
-        std::unordered_set<std::string_view> casterScale;
-        std::unordered_set<std::string_view> targetScale;
+        std::uint32_t casterScale{ 0 };
+        std::uint32_t targetScale{ 0 };
         bool casterMorph{ false };
         bool targetMorph{ false };
     };
 
-    static ResetSnapshot TakeSnapshot(std::uint32_t casterFormID)
+    static ResetSnapshot TakeSnapshot(FB::ActorRegistry::Slot casterSlot)
     {
         std::lock_guard _{ g_stateMutex };
-        auto& st = g_state[casterFormID];
+        auto& st = GetStateLocked(casterSlot);
 
         ResetSnapshot out;
         out.lastTarget = st.lastTarget;
-        out.casterScale = std::move(st.casterTouchedScale);
-        out.targetScale = std::move(st.targetTouchedScale);
+        out.casterScale = st.casterTouchedScale;
+        out.targetScale = st.targetTouchedScale;
         out.casterMorph = st.casterTouchedMorph;
         out.targetMorph = st.targetTouchedMorph;
 
-        st.casterTouchedScale.clear();
-        st.targetTouchedScale.clear();
+        st.casterTouchedScale = 0;
+        st.targetTouchedScale = 0;
         st.casterTouchedMorph = false;
         st.targetTouchedMorph = false;
 
@@ -126,90 +220,300 @@ namespace
     {
         RE::ActorHandle caster;
         RE::ActorHandle target;
-        std::uint32_t casterFormID{ 0 };
-        std::uint64_t token{ 0 };
+        std::uint32_t casterSlot{ FB::ActorRegistry::kInvalidIndex };
+        OwnerToken owner;
 
         bool logOps{ false };
 
         float elapsedSeconds{ 0.0f };
+        FB::TimelinePtr timeline;  // shared with the config snapshot; never null while active
+
+        // Clip sync: animation file whose local time drives elapsedSeconds (empty = frame time)
+        std::string syncClip;
+        bool clipFound{ false };  // logged once when the clip is first seen
+
+        // Cursor into timeline->order
         std::size_t nextIndex{ 0 };
-        std::vector<FB::TimedCommand> commands;
-    };
 
-    // Keyed by casterFormID (matches existing token + reset ownership model)
-    static std::unordered_map<std::uint32_t, ActiveTimeline> g_activeTimelines;
+        // Morph commands are additive deltas, so one that already ran must not run again after a
+        // backward seek. Indexed like timeline->morphs; empty (nothing to check) until the first seek.
+        std::vector<bool> morphApplied;
 
-    // ------------------------------------------------------------
-    // TODO(TweenRefactor): Phase 8 - active morph tweens
-    // One tween per (actor, morph key); scheduling replaces existing.
-    // ------------------------------------------------------------
-    struct TweenKey
-    {
-        std::uint32_t actorFormID{ 0 };
-        std::string morphName;
+        // Frame budget: set when neither actor is visible this tick (due commands may wait for
+        // budget); deferredFrames caps how long they wait.
+        bool offscreen{ false };
+        std::uint8_t deferredFrames{ 0 };
 
-        bool operator==(const TweenKey& o) const noexcept
+#ifndef NDEBUG
+        // Commands actually executed by a handler; must track nextIndex exactly (each command runs once).
+        std::size_t debugExecuted{ 0 };
+#endif
+
+        bool Done() const noexcept
         {
-            return actorFormID == o.actorFormID && morphName == o.morphName;
+            return nextIndex >= timeline->order.size();
         }
-    };
 
-    struct TweenKeyHash
-    {
-        std::size_t operator()(const TweenKey& k) const noexcept
+        bool HasDueCommand() const noexcept
         {
-            std::size_t h1 = std::hash<std::uint32_t>{}(k.actorFormID);
-            std::size_t h2 = std::hash<std::string>{}(k.morphName);
-            return h1 ^ (h2 + 0x9e3779b97f4a7c15ull + (h1 << 6) + (h1 >> 2));
+            return !Done() && timeline->order[nextIndex].timeSeconds <= elapsedSeconds;
         }
     };
 
+    // Off-screen due commands wait at most this many frames for budget, then run regardless.
+    static constexpr std::uint8_t kMaxDeferredFrames = 8;
+
+    // Dense, at most one per caster (matches the token + reset ownership model); Update walks it
+    // front to back. g_timelineBySlot maps a caster's registry slot to its entry.
+    // Game thread only: Update holds references into the vector across a tick, so a push_back or
+    // swap-remove from any other thread would leave them dangling. Other threads go through the
+    // inbox (StartTimeline/CancelAndReset).
+    static constexpr std::uint32_t kNoTimeline = UINT32_MAX;
+
+    // Thread that ran the first Update; debug builds check every timeline table mutation against it.
+    static std::thread::id g_gameThread;
+
+    static void AssertGameThread()
+    {
+        assert((g_gameThread == std::thread::id{} || g_gameThread == std::this_thread::get_id()) &&
+               "timeline tables are game-thread-only");
+    }
+
+    static std::vector<ActiveTimeline> g_activeTimelines;
+    static std::array<std::uint32_t, FB::ActorRegistry::kCapacity> g_timelineBySlot = [] {
+        std::array<std::uint32_t, FB::ActorRegistry::kCapacity> bySlot;
+        bySlot.fill(kNoTimeline);
+        return bySlot;
+    }();
+
+    // Swap-remove g_activeTimelines[i], keeping the slot index of the entry moved into its place current.
+    static void RemoveTimeline(std::size_t i)
+    {
+        AssertGameThread();
+
+        g_timelineBySlot[g_activeTimelines[i].casterSlot] = kNoTimeline;
+
+        if (i + 1 != g_activeTimelines.size()) {
+            g_activeTimelines[i] = std::move(g_activeTimelines.back());
+            g_timelineBySlot[g_activeTimelines[i].casterSlot] = static_cast<std::uint32_t>(i);
+        }
+        g_activeTimelines.pop_back();
+    }
+
+    static void RemoveTimelineForCaster(std::uint32_t casterSlot)
+    {
+        if (const auto i = g_timelineBySlot[casterSlot]; i != kNoTimeline) {
+            RemoveTimeline(i);
+        }
+    }
+
+    // ------------------------------------------------------------
+    // TODO(TweenRefactor): Phase 8 - active morph tweens
+    // One tween per (actor, morph); scheduling replaces existing in place.
+    // Dense array like g_scaleTweens: replacement and removal never allocate once capacity is reached.
+    // ------------------------------------------------------------
     struct ActiveTween
     {
         RE::ActorHandle actor;
         std::uint32_t actorFormID{ 0 };
 
         // Ownership for reset/token validity
-        std::uint32_t casterFormID{ 0 };
-        std::uint64_t token{ 0 };
+        std::uint32_t casterSlot{ FB::ActorRegistry::kInvalidIndex };
+        OwnerToken owner;
         FB::TargetKind who{ FB::TargetKind::kCaster };
 
-        std::string morphName;
+        FB::Morph::MorphId morph{ FB::Morph::kInvalidMorphId };
         float totalDelta{ 0.0f };
         float appliedSoFar{ 0.0f };
 
         float durationSeconds{ 0.0f };
         float elapsedSeconds{ 0.0f };
+        float sinceStep{ 0.0f };  // effect LOD: time since the last written step
 
         bool touchedMarked{ false };
     };
 
-    static std::unordered_map<TweenKey, ActiveTween, TweenKeyHash> g_activeTweens;
+    static std::vector<ActiveTween> g_activeTweens;
+
+    static ActiveTween* FindMorphTween(std::uint32_t actorFormID, FB::Morph::MorphId morph)
+    {
+        for (auto& tw : g_activeTweens) {
+            if (tw.actorFormID == actorFormID && tw.morph == morph) {
+                return std::addressof(tw);
+            }
+        }
+        return nullptr;
+    }
+
+    // ------------------------------------------------------------
+    // Active scale tweens
+    // Dense array advanced once per tick; each step is written into g_scaleBatch, so any number of
+    // tweening nodes on one actor still costs one task per frame. One tween per (actor, node).
+    // ------------------------------------------------------------
+    struct ScaleTween
+    {
+        RE::ActorHandle actor;
+        std::uint32_t casterSlot{ FB::ActorRegistry::kInvalidIndex };
+        OwnerToken owner;
+
+        FB::Scaler::NodeId node{ FB::Scaler::NodeId::kHead };
+        float from{ 1.0f };
+        float to{ 1.0f };
+
+        float durationSeconds{ 0.0f };
+        float elapsedSeconds{ 0.0f };
+        float sinceStep{ 0.0f };  // effect LOD: time since the last written step
+
+        bool logOps{ false };
+    };
+
+    static std::vector<ScaleTween> g_scaleTweens;
+
+    // Effect LOD for one tween step: near actors step every tick, far ones at the far rate, culled
+    // ones not at all. The last step always goes out, so an actor back in view shows the final value
+    // (or, mid-tween, the current one: steps are computed from elapsed time, not accumulated).
+    static bool TweenStepDue(const RE::Actor* actor, float& sinceStep, float dtSeconds, bool finished)
+    {
+        sinceStep += dtSeconds;
+        if (!finished) {
+            switch (FB::Scheduler::GetLod(actor)) {
+            case FB::Scheduler::Lod::kNear:
+                break;
+            case FB::Scheduler::Lod::kFar:
+                if (sinceStep < FB::Scheduler::FarUpdateInterval()) {
+                    return false;
+                }
+                break;
+            case FB::Scheduler::Lod::kCulled:
+                return false;
+            }
+        }
+
+        sinceStep = 0.0f;
+        return true;
+    }
+
+    // Swap-remove; returns true if a tween for (actor, node) existed.
+    static bool CancelScaleTween(RE::ActorHandle actor, FB::Scaler::NodeId node)
+    {
+        for (std::size_t i = 0; i < g_scaleTweens.size(); ++i) {
+            if (g_scaleTweens[i].actor == actor && g_scaleTweens[i].node == node) {
+                g_scaleTweens[i] = std::move(g_scaleTweens.back());
+                g_scaleTweens.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Scale writes gathered during one Update tick; flushed as one SKSE task per actor.
+    static FB::Scaler::Batch g_scaleBatch;
+
+    // Scale restores for the partners of unloaded casters (ForgetActor). Lowest priority: drained
+    // front to back while the frame has budget left.
+    struct PendingReset
+    {
+        RE::ActorHandle actor;
+        std::uint32_t nodeMask{ 0 };
+    };
+
+    static std::vector<PendingReset> g_pendingResets;
+
+    // A new timeline on an actor with a queued restore takes it into this tick's batch first, so the
+    // timeline's own writes (queued later, last write wins) are never undone by the old restore.
+    static void TakePendingResets(RE::ActorHandle actor)
+    {
+        if (!actor) {
+            return;
+        }
+
+        std::erase_if(g_pendingResets, [&](const PendingReset& r) {
+            if (r.actor != actor) {
+                return false;
+            }
+            g_scaleBatch.ResetMask(r.actor, r.nodeMask, false);
+            return true;
+        });
+    }
+
+    static void DrainPendingResets()
+    {
+        std::size_t drained = 0;
+        for (; drained < g_pendingResets.size() && FB::Scheduler::HasBudget(); ++drained) {
+            g_scaleBatch.ResetMask(g_pendingResets[drained].actor, g_pendingResets[drained].nodeMask, false);
+        }
+        g_pendingResets.erase(g_pendingResets.begin(), g_pendingResets.begin() + static_cast<std::ptrdiff_t>(drained));
+
+        FB_STATS_ADD(kDeferredResets, g_pendingResets.size());
+    }
 
     static RE::ActorHandle ResolveActor(const ActiveTimeline& tl, FB::TargetKind who)
     {
         return (who == FB::TargetKind::kCaster) ? tl.caster : tl.target;
     }
 
-    static void ExecuteScale(std::uint32_t casterFormID, RE::ActorHandle actor, const FB::TimedCommand& cmd, bool logOps)
+    // Time the tween loops will still add this tick to a tween created now: the tick's dt while
+    // Update runs the timelines, 0 outside it (e.g. a SeekTimeline call between ticks).
+    static float g_pendingTweenAdvance = 0.0f;
+
+    // Sub-frame start: a tween due part-way through the frame begins already (elapsed - due) seconds
+    // in, as if it had started exactly on time, instead of at the frame boundary.
+    static float TweenStartElapsed(const ActiveTimeline& tl, float dueSeconds)
+    {
+        return std::max(0.0f, tl.elapsedSeconds - dueSeconds) - g_pendingTweenAdvance;
+    }
+
+    static void ExecuteScale(const OwnerToken& owner, RE::ActorHandle actor, const FB::ScaleEvent& cmd, bool logOps)
+    {
+        if (!actor) {
+            return;
+        }
+        // An instant set wins over a tween still running on the same node.
+        CancelScaleTween(actor, cmd.node);
+
+        g_scaleBatch.Set(actor, cmd.node, cmd.scale, logOps);
+        MarkTouchedScale(owner, cmd.target, cmd.node);
+    }
+
+    static void ScheduleScaleTween(const ActiveTimeline& tl, RE::ActorHandle actor, const FB::ScaleEvent& cmd)
     {
         if (!actor) {
             return;
         }
-        FB::Scaler::SetNodeScale(actor, cmd.nodeKey, cmd.scale, logOps);
-        MarkTouchedScale(casterFormID, cmd.target, cmd.nodeKey);
+
+        // Start from what this tick already queued for the node, else its live scale (we are on the game thread).
+        auto from = g_scaleBatch.Peek(actor, cmd.node);
+        if (!from) {
+            from = FB::Scaler::GetNodeScale(actor, cmd.node);
+        }
+
+        CancelScaleTween(actor, cmd.node);
+
+        ScaleTween tw;
+        tw.actor = actor;
+        tw.casterSlot = tl.casterSlot;
+        tw.owner = tl.owner;
+        tw.node = cmd.node;
+        tw.from = from.value_or(1.0f);
+        tw.to = cmd.scale;
+        tw.durationSeconds = cmd.tweenSeconds;
+        tw.elapsedSeconds = TweenStartElapsed(tl, cmd.timeSeconds);
+        tw.logOps = tl.logOps;
+
+        g_scaleTweens.push_back(std::move(tw));
+        MarkTouchedScale(tl.owner, cmd.target, cmd.node);
     }
 
-    static void ExecuteMorphInstant(std::uint32_t casterFormID, RE::ActorHandle actor, const FB::TimedCommand& cmd, bool logOps)
+    static void ExecuteMorphInstant(const OwnerToken& owner, RE::ActorHandle actor, const FB::MorphEvent& cmd, bool logOps)
     {
         if (!actor) {
             return;
         }
-        FB::Morph::AddDelta(actor, cmd.morphName, cmd.delta, logOps);
-        MarkTouchedMorph(casterFormID, cmd.target);
+        FB::Morph::AddDelta(actor, cmd.morph, cmd.delta, logOps);
+        MarkTouchedMorph(owner, cmd.target);
     }
 
-    static void ScheduleMorphTween(const ActiveTimeline& tl, const FB::TimedCommand& cmd)
+    static void ScheduleMorphTween(const ActiveTimeline& tl, const FB::MorphEvent& cmd)
     {
         RE::ActorHandle actor = ResolveActor(tl, cmd.target);
         if (!actor) {
@@ -225,24 +529,27 @@ namespace
         tw.actor = actor;
         tw.actorFormID = a->GetFormID();
 
-        tw.casterFormID = tl.casterFormID;
-        tw.token = tl.token;
+        tw.casterSlot = tl.casterSlot;
+        tw.owner = tl.owner;
         tw.who = cmd.target;
 
-        tw.morphName = cmd.morphName;
+        tw.morph = cmd.morph;
         tw.totalDelta = cmd.delta;
         tw.appliedSoFar = 0.0f;
 
         tw.durationSeconds = cmd.tweenSeconds;
-        tw.elapsedSeconds = 0.0f;
-
-        TweenKey key{ tw.actorFormID, tw.morphName };
+        tw.elapsedSeconds = TweenStartElapsed(tl, cmd.timeSeconds);
 
-        // Replacement rule: one tween per (actor, morph key)
-        g_activeTweens[key] = std::move(tw);
+        // Replacement rule: one tween per (actor, morph)
+        if (auto* existing = FindMorphTween(tw.actorFormID, tw.morph)) {
+            *existing = std::move(tw);
+        }
+        else {
+            g_activeTweens.push_back(std::move(tw));
+        }
     }
 
-    static void ExecuteHide(std::uint32_t /*casterFormID*/, RE::ActorHandle actor, const FB::TimedCommand& cmd, bool logOps)
+    static void ExecuteHide(const OwnerToken& /*owner*/, RE::ActorHandle actor, const FB::HideEvent& cmd, bool logOps)
     {
         if (!actor) {
             return;
@@ -257,165 +564,438 @@ namespace
     }
 
 
-    static void ClearTweensForCaster(std::uint32_t casterFormID)
+    static void ClearTweensForCaster(std::uint32_t casterSlot)
     {
-        for (auto it = g_activeTweens.begin(); it != g_activeTweens.end(); ) {
-            if (it->second.casterFormID == casterFormID) {
-                it = g_activeTweens.erase(it);
+        std::erase_if(g_scaleTweens, [casterSlot](const ScaleTween& tw) { return tw.casterSlot == casterSlot; });
+
+        std::erase_if(g_activeTweens, [casterSlot](const ActiveTween& tw) { return tw.casterSlot == casterSlot; });
+    }
+
+    // ------------------------------------------------------------
+    // Command dispatch
+    // One handler per CommandKind, indexed by kind: executing a command is one indirect call,
+    // and a new kind is a new payload array + handler, not another branch in Update.
+    // ------------------------------------------------------------
+    using CommandHandler = void (*)(ActiveTimeline& tl, std::uint32_t index);
+
+    // Every handler calls this once; Update asserts the count matches the cursor.
+    static void NoteExecuted([[maybe_unused]] ActiveTimeline& tl)
+    {
+#ifndef NDEBUG
+        ++tl.debugExecuted;
+#endif
+    }
+
+    static void HandleScale(ActiveTimeline& tl, std::uint32_t index)
+    {
+        NoteExecuted(tl);
+        const auto& cmd = tl.timeline->scales[index];
+        if (cmd.tweenSeconds > 0.0f) {
+            ScheduleScaleTween(tl, ResolveActor(tl, cmd.target), cmd);
+        }
+        else {
+            ExecuteScale(tl.owner, ResolveActor(tl, cmd.target), cmd, tl.logOps);
+        }
+    }
+
+    static void HandleMorph(ActiveTimeline& tl, std::uint32_t index)
+    {
+        NoteExecuted(tl);
+        const auto& cmd = tl.timeline->morphs[index];
+
+        // TODO(TweenRefactor Phase 9): runtime currently supports LINEAR tween curves only.
+        // Parser is expected to enforce this, but we defensively guard here.
+#ifndef NDEBUG
+        assert(cmd.tweenCurve == FB::TweenCurve::kLinear);
+#endif
+
+        if (cmd.tweenCurve != FB::TweenCurve::kLinear) {
+            // Should never happen unless parser rules are bypassed or future changes forget to update runtime.
+            if (tl.logOps) {
+                spdlog::warn(
+                    "[FB] Non-linear tween curve reached runtime (forcing linear). morph='{}'",
+                    FB::Morph::MorphName(cmd.morph));
             }
-            else {
-                ++it;
+            // No behavior change: we continue using linear progression.
+        }
+
+        // Phase 8: if tweenSeconds > 0, schedule a tween instead of instant apply
+        if (cmd.tweenSeconds > 0.0f) {
+            ScheduleMorphTween(tl, cmd);
+        }
+        else {
+            ExecuteMorphInstant(tl.owner, ResolveActor(tl, cmd.target), cmd, tl.logOps);
+        }
+    }
+
+    static void HandleHide(ActiveTimeline& tl, std::uint32_t index)
+    {
+        NoteExecuted(tl);
+        const auto& cmd = tl.timeline->hides[index];
+        ExecuteHide(tl.owner, ResolveActor(tl, cmd.target), cmd, tl.logOps);
+    }
+
+    static constexpr std::array<CommandHandler, FB::kCommandKindCount> kCommandHandlers{
+        &HandleScale,  // CommandKind::kScale
+        &HandleMorph,  // CommandKind::kMorph
+        &HandleHide,   // CommandKind::kHide
+    };
+
+    static_assert(static_cast<std::size_t>(FB::CommandKind::kScale) == 0 &&
+                  static_cast<std::size_t>(FB::CommandKind::kMorph) == 1 &&
+                  static_cast<std::size_t>(FB::CommandKind::kHide) == 2,
+        "kCommandHandlers is indexed by CommandKind");
+
+    // Execute every command due at or before tl.elapsedSeconds, in time order: one table dispatch each.
+    static void RunDueCommands(ActiveTimeline& tl)
+    {
+        const auto& order = tl.timeline->order;
+        for (; tl.nextIndex < order.size(); ++tl.nextIndex) {
+            const auto& ref = order[tl.nextIndex];
+            if (ref.timeSeconds > tl.elapsedSeconds) {
+                break;
+            }
+
+            if (ref.kind == FB::CommandKind::kMorph && !tl.morphApplied.empty()) {
+                if (tl.morphApplied[ref.index]) {
+                    NoteExecuted(tl);  // replayed after a backward seek: its delta is already applied
+                    continue;
+                }
+                tl.morphApplied[ref.index] = true;
+            }
+
+            kCommandHandlers[static_cast<std::size_t>(ref.kind)](tl, ref.index);
+        }
+
+#ifndef NDEBUG
+        assert(tl.debugExecuted == tl.nextIndex && "each timeline command must execute exactly once");
+#endif
+    }
+
+    // Frame time, or the synced clip's local time when it is playing. Clip time only moves the cursor
+    // forward: a looping or restarted clip does not replay commands that already ran.
+    static void AdvanceClock(ActiveTimeline& tl, float dtSeconds)
+    {
+        if (tl.syncClip.empty()) {
+            tl.elapsedSeconds += dtSeconds;
+            return;
+        }
+
+        const auto caster = tl.caster.get();
+        const auto clipTime = FB::ClipTime::Sample(caster.get(), tl.syncClip);
+        if (!clipTime) {
+            tl.elapsedSeconds += dtSeconds;
+            return;
+        }
+
+        if (!tl.clipFound) {
+            tl.clipFound = true;
+            if (tl.logOps) {
+                spdlog::info("[FB] ClipSync: '{}' on '{}' at t={:.3f} (timeline t={:.3f})",
+                    tl.syncClip, caster ? caster->GetName() : "<null>", *clipTime, tl.elapsedSeconds);
             }
         }
+
+        tl.elapsedSeconds = std::max(tl.elapsedSeconds, *clipTime);
+    }
+
+    // First command strictly after timeSeconds (binary search; order is sorted by time).
+    static std::size_t FirstCommandAfter(const FB::CompiledTimeline& timeline, float timeSeconds)
+    {
+        const auto it = std::upper_bound(timeline.order.begin(), timeline.order.end(), timeSeconds,
+            [](float t, const FB::CommandRef& ref) { return t < ref.timeSeconds; });
+        return static_cast<std::size_t>(it - timeline.order.begin());
     }
 }
 
-namespace FB::ActorManager
+namespace
 {
-    void StartTimeline(
-        RE::ActorHandle caster,
-        RE::ActorHandle target,
-        std::uint32_t casterFormID,
-        std::vector<FB::TimedCommand> commands,
-        bool logOps)
+    // ------------------------------------------------------------
+    // Start/cancel inbox
+    // Animation graph events arrive on whatever thread runs that graph (NPC graphs update on worker
+    // threads), while every runtime table in this file is game-thread-only. StartTimeline and
+    // CancelAndReset only queue a request; Update applies them in arrival order before the tick.
+    // ------------------------------------------------------------
+    struct InboxRequest
+    {
+        enum class Kind : std::uint8_t
+        {
+            kStart,
+            kCancel,
+        };
+
+        Kind kind{ Kind::kStart };
+        RE::ActorHandle caster;
+        FB::ActorRegistry::Slot casterSlot;
+        bool logOps{ false };
+
+        // kStart
+        RE::ActorHandle target;
+        FB::TimelinePtr timeline;
+        std::string syncClip;
+
+        // kCancel
+        bool resetMorphCaster{ false };
+        bool resetMorphTarget{ false };
+    };
+
+    static std::mutex g_inboxMutex;
+    static std::vector<InboxRequest> g_inbox;  // guarded by g_inboxMutex
+
+    // Game thread only: swapped with g_inbox each tick so neither buffer reallocates once warm.
+    static std::vector<InboxRequest> g_inboxDrain;
+
+    static void PostRequest(InboxRequest&& request)
+    {
+        std::lock_guard _{ g_inboxMutex };
+        g_inbox.push_back(std::move(request));
+    }
+
+    static void StartTimelineNow(InboxRequest& req)
     {
-        if (!caster) {
+        // The slot may have been released (actor unloaded) after the request was queued.
+        if (!req.caster || !FB::ActorRegistry::IsCurrent(req.casterSlot) || !req.timeline || req.timeline->Empty()) {
             return;
         }
 
+        const auto casterSlot = req.casterSlot;
+
+        AssertGameThread();
+
         // TODO(TweenRefactor): Phase 7 - remove thread-per-command timing; register deterministic runtime state
-        const auto token = BumpToken(casterFormID);
-        SetLastTarget(casterFormID, target);
+        const auto owner = BumpToken(casterSlot);
+        SetLastTarget(casterSlot, req.target);
 
         ActiveTimeline tl;
-        tl.caster = caster;
-        tl.target = target;
-        tl.casterFormID = casterFormID;
-        tl.token = token;
-        tl.logOps = logOps;
+        tl.caster = req.caster;
+        tl.target = req.target;
+        tl.casterSlot = casterSlot.index;
+        tl.owner = owner;
+        tl.logOps = req.logOps;
         tl.elapsedSeconds = 0.0f;
-        tl.nextIndex = 0;
-        tl.commands = std::move(commands);
+        tl.timeline = std::move(req.timeline);
+        tl.syncClip = std::move(req.syncClip);
+
+        // Restores still queued for either actor are folded into this tick's batch here, on the game
+        // thread, so the new timeline's writes land after them.
+        TakePendingResets(tl.caster);
+        TakePendingResets(tl.target);
+
+        // One timeline per caster: a restart replaces the running one in place
+        auto& at = g_timelineBySlot[casterSlot.index];
+        if (at != kNoTimeline) {
+            g_activeTimelines[at] = std::move(tl);
+        }
+        else {
+            at = static_cast<std::uint32_t>(g_activeTimelines.size());
+            g_activeTimelines.push_back(std::move(tl));
+        }
+    }
+
+    static void CancelAndResetNow(const InboxRequest& req)
+    {
+        const auto& caster = req.caster;
+        const auto casterSlot = req.casterSlot;
+        const bool logOps = req.logOps;
+        const bool resetMorphCaster = req.resetMorphCaster;
+        const bool resetMorphTarget = req.resetMorphTarget;
+
+        // A caster without a (current) slot never started anything: only its hide and the requested morph resets apply.
+        ResetSnapshot snap;
+        if (FB::ActorRegistry::IsCurrent(casterSlot)) {
+            // Invalidate all pending work
+            (void)BumpToken(casterSlot);
+
+            // TODO(TweenRefactor): Phase 7/8 - clear deterministic timelines and tweens for this caster
+            RemoveTimelineForCaster(casterSlot.index);
+            ClearTweensForCaster(casterSlot.index);
+
+            snap = TakeSnapshot(casterSlot);
+        }
+
+        // All restores for an actor go out as a single task (one handle resolve, one pass over the nodes)
+        FB::Scaler::Batch resetBatch;
+
+        // Hides applied by the pair's commands are restored with the scales (no-op for untouched actors)
+        if (caster) {
+            resetBatch.ResetMask(caster, snap.casterScale, logOps);
+            FB::Hide::ResetActor(caster, logOps);
+
+            if (resetMorphCaster) {
+                FB::Morph::ResetAllForActor(caster, logOps);
+            }
+        }
+
+        if (snap.lastTarget) {
+            resetBatch.ResetMask(snap.lastTarget, snap.targetScale, logOps);
+            FB::Hide::ResetActor(snap.lastTarget, logOps);
+
+            if (resetMorphTarget) {
+                FB::Morph::ResetAllForActor(snap.lastTarget, logOps);
+            }
+        }
+
+        resetBatch.Flush();
+
+        if (logOps) {
+            auto c = caster.get();
+            spdlog::info("[FB] Reset: caster='{}' casterNodes={} targetNodes={} resetMorphCaster={} resetMorphTarget={}",
+                c ? c->GetName() : "<null>",
+                std::popcount(snap.casterScale),
+                std::popcount(snap.targetScale),
+                resetMorphCaster,
+                resetMorphTarget);
+        }
+    }
+
+    static void DrainInbox()
+    {
+        {
+            std::lock_guard _{ g_inboxMutex };
+            if (g_inbox.empty()) {
+                return;
+            }
+            g_inbox.swap(g_inboxDrain);
+        }
+
+        for (auto& req : g_inboxDrain) {
+            if (req.kind == InboxRequest::Kind::kStart) {
+                StartTimelineNow(req);
+            }
+            else {
+                CancelAndResetNow(req);
+            }
+        }
+        g_inboxDrain.clear();
+    }
+}
+
+namespace FB::ActorManager
+{
+    void StartTimeline(
+        RE::ActorHandle caster,
+        RE::ActorHandle target,
+        FB::ActorRegistry::Slot casterSlot,
+        FB::TimelinePtr timeline,
+        bool logOps,
+        std::string_view syncClip)
+    {
+        if (!caster || !casterSlot.Valid() || !timeline || timeline->Empty()) {
+            return;
+        }
 
-        g_activeTimelines[casterFormID] = std::move(tl);
+        InboxRequest req;
+        req.kind = InboxRequest::Kind::kStart;
+        req.caster = caster;
+        req.casterSlot = casterSlot;
+        req.logOps = logOps;
+        req.target = target;
+        req.timeline = std::move(timeline);
+        req.syncClip = syncClip;
+        PostRequest(std::move(req));
     }
 
     void Update(float dtSeconds)
     {
         // TODO(TweenRefactor): Phase 6/7/8 - deterministic tick entry point (called from PlayerCharacter::Update hook)
 
+        if (g_gameThread == std::thread::id{}) {
+            g_gameThread = std::this_thread::get_id();
+        }
+
+        // Starts and cancels queued by the event sinks since the last tick, in arrival order
+        DrainInbox();
+
         // Required safety: skip dt <= 0
         if (dtSeconds <= 0.0f) {
             return;
         }
 
+        FB_STATS_TIMER(kUpdate);
+
         // Required safety: clamp pathological dt spikes (loading/hitch/pause)
         constexpr float kMaxDtSeconds = 0.25f;
         if (dtSeconds > kMaxDtSeconds) {
             dtSeconds = kMaxDtSeconds;
         }
 
-        // 1) Advance deterministic timelines
-        for (auto it = g_activeTimelines.begin(); it != g_activeTimelines.end(); ) {
-            ActiveTimeline& tl = it->second;
+        // 1) Advance deterministic timelines. Every clock moves; due commands run for visible actors
+        //    first, then for off-screen (LOD-culled: unloaded, hidden or past LodCullDistance) ones while
+        //    the frame budget lasts. A deferred command runs on a
+        //    later tick, its tweens started at the right offset (TweenStartElapsed).
+        g_pendingTweenAdvance = dtSeconds;
+        for (std::size_t i = 0; i < g_activeTimelines.size(); ) {
+            ActiveTimeline& tl = g_activeTimelines[i];
 
             // Token validity must be checked before executing any work
-            if (!IsTokenCurrent(tl.casterFormID, tl.token)) {
-                it = g_activeTimelines.erase(it);
+            if (!tl.owner.IsCurrent()) {
+                RemoveTimeline(i);
                 continue;
             }
 
-            tl.elapsedSeconds += dtSeconds;
-
-            // Execute all due commands in correct order
-            while (tl.nextIndex < tl.commands.size()) {
-                const auto& cmd = tl.commands[tl.nextIndex];
-                if (cmd.timeSeconds > tl.elapsedSeconds) {
-                    break;
-                }
-
-                // Resolve target actor for this command
-                const auto actorHandle = ResolveActor(tl, cmd.target);
-                if (cmd.kind == FB::CommandKind::kScale) {
-                    ExecuteScale(tl.casterFormID, actorHandle, cmd, tl.logOps);
-                }
-                else if (cmd.kind == FB::CommandKind::kHide) {
-                    ExecuteHide(tl.casterFormID, actorHandle, cmd, tl.logOps);
-                }
-
-                if (cmd.kind == FB::CommandKind::kScale) {
-                    ExecuteScale(tl.casterFormID, actorHandle, cmd, tl.logOps);
-                }
-                else if (cmd.kind == FB::CommandKind::kHide) {
-                    ExecuteHide(tl.casterFormID, actorHandle, cmd, tl.logOps);
-                }
-
-                else if (cmd.kind == FB::CommandKind::kMorph) {
-
-                    // TODO(TweenRefactor Phase 9): runtime currently supports LINEAR tween curves only.
-                    // Parser is expected to enforce this, but we defensively guard here.
-#ifndef NDEBUG
-                    assert(cmd.tweenCurve == FB::TweenCurve::kLinear);
-#endif
-
-                    if (cmd.tweenCurve != FB::TweenCurve::kLinear) {
-                        // Should never happen unless parser rules are bypassed or future changes forget to update runtime.
-                        if (tl.logOps) {
-                            spdlog::warn(
-                                "[FB] Non-linear tween curve reached runtime (forcing linear). morph='{}'",
-                                cmd.morphName);
-                        }
-                        // No behavior change: we continue using linear progression.
-                    }
-
-                    // Phase 8: if tweenSeconds > 0, schedule a tween instead of instant apply
-                    if (cmd.tweenSeconds > 0.0f) {
-                        ScheduleMorphTween(tl, cmd);
-                    }
-                    else {
-                        ExecuteMorphInstant(tl.casterFormID, actorHandle, cmd, tl.logOps);
-                    }
-                }
-
+            AdvanceClock(tl, dtSeconds);
 
-
-                ++tl.nextIndex;
+            tl.offscreen = tl.HasDueCommand() &&
+                tl.deferredFrames < kMaxDeferredFrames &&
+                FB::Scheduler::GetLod(tl.caster.get().get()) == FB::Scheduler::Lod::kCulled &&
+                FB::Scheduler::GetLod(tl.target.get().get()) == FB::Scheduler::Lod::kCulled;
+            if (tl.offscreen) {
+                ++i;
+                continue;
             }
 
+            RunDueCommands(tl);
+            tl.deferredFrames = 0;
+
             // Done
-            if (tl.nextIndex >= tl.commands.size()) {
-                it = g_activeTimelines.erase(it);
+            if (tl.Done()) {
+                RemoveTimeline(i);
                 continue;
             }
 
-            ++it;
+            ++i;
         }
 
-        // 2) Advance active tweens (after timeline scheduling)
-        for (auto it = g_activeTweens.begin(); it != g_activeTweens.end(); ) {
-            ActiveTween& tw = it->second;
-
-            // Token validity must be checked before applying any morph delta
-            if (!IsTokenCurrent(tw.casterFormID, tw.token)) {
-                it = g_activeTweens.erase(it);
+        std::size_t deferredTimelines = 0;
+        for (std::size_t i = 0; i < g_activeTimelines.size(); ) {
+            ActiveTimeline& tl = g_activeTimelines[i];
+            if (!tl.offscreen) {
+                ++i;
                 continue;
             }
 
-            if (!tw.actor) {
-                it = g_activeTweens.erase(it);
+            tl.offscreen = false;
+            if (!FB::Scheduler::HasBudget()) {
+                ++tl.deferredFrames;
+                ++deferredTimelines;
+                ++i;
                 continue;
             }
 
-            auto a = tw.actor.get();  // NiPointer<RE::Actor>
-            if (!a) {
-                it = g_activeTweens.erase(it);
+            RunDueCommands(tl);
+            tl.deferredFrames = 0;
+
+            if (tl.Done()) {
+                RemoveTimeline(i);
                 continue;
             }
 
+            ++i;
+        }
+
+        g_pendingTweenAdvance = 0.0f;
+        FB_STATS_ADD(kDeferredTimelines, deferredTimelines);
 
-            // Protect against bad durations
-            if (tw.durationSeconds <= 0.0f) {
-                it = g_activeTweens.erase(it);
+        // 2) Advance active tweens (after timeline scheduling)
+        for (std::size_t i = 0; i < g_activeTweens.size(); ) {
+            ActiveTween& tw = g_activeTweens[i];
+
+            // Token validity must be checked before applying any morph delta.
+            // Dead actor handles and bad durations are dropped the same way (swap-remove; order is irrelevant).
+            const auto actor = tw.actor.get();
+            if (!tw.owner.IsCurrent() || !actor || tw.durationSeconds <= 0.0f) {
+                tw = std::move(g_activeTweens.back());
+                g_activeTweens.pop_back();
                 continue;
             }
 
@@ -425,12 +1005,12 @@ namespace FB::ActorManager
             const float targetApplied = tw.totalDelta * alpha;
             const float stepDelta = targetApplied - tw.appliedSoFar;
 
-            if (stepDelta != 0.0f) {
-                FB::Morph::AddDelta(tw.actor, tw.morphName, stepDelta, false);
+            if (stepDelta != 0.0f && TweenStepDue(actor.get(), tw.sinceStep, dtSeconds, alpha >= 1.0f)) {
+                FB::Morph::AddDelta(tw.actor, tw.morph, stepDelta, false);
 
                 // Mark touched morph only once we actually apply something
                 if (!tw.touchedMarked) {
-                    MarkTouchedMorph(tw.casterFormID, tw.who);
+                    MarkTouchedMorph(tw.owner, tw.who);
                     tw.touchedMarked = true;
                 }
 
@@ -438,58 +1018,176 @@ namespace FB::ActorManager
             }
 
             if (alpha >= 1.0f) {
-                it = g_activeTweens.erase(it);
+                tw = std::move(g_activeTweens.back());
+                g_activeTweens.pop_back();
                 continue;
             }
 
-            ++it;
+            ++i;
+        }
+
+        // 3) Advance scale tweens; every step lands in this tick's scale batch
+        for (std::size_t i = 0; i < g_scaleTweens.size(); ) {
+            ScaleTween& tw = g_scaleTweens[i];
+
+            if (!tw.owner.IsCurrent() || !tw.actor || tw.durationSeconds <= 0.0f) {
+                tw = std::move(g_scaleTweens.back());
+                g_scaleTweens.pop_back();
+                continue;
+            }
+
+            tw.elapsedSeconds += dtSeconds;
+
+            const float alpha = std::clamp(tw.elapsedSeconds / tw.durationSeconds, 0.0f, 1.0f);
+            if (TweenStepDue(tw.actor.get().get(), tw.sinceStep, dtSeconds, alpha >= 1.0f)) {
+                g_scaleBatch.Set(tw.actor, tw.node, tw.from + (tw.to - tw.from) * alpha, tw.logOps && alpha >= 1.0f);
+            }
+
+            if (alpha >= 1.0f) {
+                tw = std::move(g_scaleTweens.back());
+                g_scaleTweens.pop_back();
+                continue;
+            }
+
+            ++i;
+        }
+
+        // 4) Commit this tick's touched state (the only g_stateMutex acquisition in a tick)
+        CommitTouched();
+
+        // 5) Lowest-priority scale work: restores for unloaded casters' partners, budget permitting
+        DrainPendingResets();
+
+        // 6) Apply this tick's scale writes: one task per actor
+        g_scaleBatch.Flush();
+
+        // 7) Sticky morph hold/tween scheduler (20 Hz re-apply), same tick as the timeline tweens;
+        //    off-screen re-applies wait while the frame is over budget
+        FB::Morph::UpdateSticky();
+
+        // 8) Flush batched morph writes: one bridge call / UpdateModelWeight per actor per frame
+        FB::Morph::FlushPending();
+
+        FB_STATS_SET(kActiveTimelines, g_activeTimelines.size());
+        FB_STATS_SET(kMorphTweens, g_activeTweens.size());
+        FB_STATS_SET(kScaleTweens, g_scaleTweens.size());
+    }
+
+    bool SeekTimeline(FB::ActorRegistry::Slot casterSlot, float timeSeconds, bool runSkipped)
+    {
+        AssertGameThread();
+
+        if (!casterSlot.Valid()) {
+            return false;
+        }
+
+        const auto at = g_timelineBySlot[casterSlot.index];
+        if (at == kNoTimeline) {
+            return false;
+        }
+
+        ActiveTimeline& tl = g_activeTimelines[at];
+        if (!tl.owner.IsCurrent()) {
+            return false;  // Update drops it
+        }
+
+        // Until the first seek every command before the cursor has run exactly once: start tracking
+        // which morph deltas are in, so replaying or skipping past them never stacks a delta.
+        if (tl.morphApplied.empty() && !tl.timeline->morphs.empty()) {
+            tl.morphApplied.resize(tl.timeline->morphs.size());
+            for (std::size_t i = 0; i < tl.nextIndex; ++i) {
+                if (const auto& ref = tl.timeline->order[i]; ref.kind == FB::CommandKind::kMorph) {
+                    tl.morphApplied[ref.index] = true;
+                }
+            }
+        }
+
+        timeSeconds = std::max(0.0f, timeSeconds);
+        const bool forward = timeSeconds >= tl.elapsedSeconds;
+        tl.elapsedSeconds = timeSeconds;
+
+        if (forward && runSkipped) {
+            // Commands in between fire now; their tweens start part-way through (TweenStartElapsed).
+            RunDueCommands(tl);
+        }
+        else {
+            tl.nextIndex = FirstCommandAfter(*tl.timeline, timeSeconds);
+#ifndef NDEBUG
+            tl.debugExecuted = tl.nextIndex;
+#endif
+        }
+
+        if (tl.logOps) {
+            spdlog::info("[FB] Seek: casterSlot={} t={:.3f} next={}/{} runSkipped={}",
+                casterSlot.index, timeSeconds, tl.nextIndex, tl.timeline->order.size(), runSkipped);
         }
+
+        // A finished timeline is removed by the next Update.
+        return true;
     }
 
     void CancelAndReset(
         RE::ActorHandle caster,
-        std::uint32_t casterFormID,
+        FB::ActorRegistry::Slot casterSlot,
         bool logOps,
         bool resetMorphCaster,
         bool resetMorphTarget)
     {
-        // Invalidate all pending work
-        (void)BumpToken(casterFormID);
-
-        // TODO(TweenRefactor): Phase 7/8 - clear deterministic timelines and tweens for this caster
-        g_activeTimelines.erase(casterFormID);
-        ClearTweensForCaster(casterFormID);
+        InboxRequest req;
+        req.kind = InboxRequest::Kind::kCancel;
+        req.caster = caster;
+        req.casterSlot = casterSlot;
+        req.logOps = logOps;
+        req.resetMorphCaster = resetMorphCaster;
+        req.resetMorphTarget = resetMorphTarget;
+        PostRequest(std::move(req));
+    }
 
-        auto snap = TakeSnapshot(casterFormID);
+    void ForgetActor(FB::ActorRegistry::Slot casterSlot)
+    {
+        if (!casterSlot.Valid()) {
+            return;
+        }
 
-        if (caster) {
-            for (auto node : snap.casterScale) {
-                FB::Scaler::SetNodeScale(caster, node, 1.0f, logOps);
-            }
+        (void)BumpToken(casterSlot);
+        RemoveTimelineForCaster(casterSlot.index);
+        ClearTweensForCaster(casterSlot.index);
 
-            if (resetMorphCaster) {
-                FB::Morph::ResetAllForActor(caster, logOps);
-            }
+        // No pair-end can reach this caster anymore: put back what it scaled on its partner.
+        // Queued behind this frame's visible work (DrainPendingResets).
+        const auto snap = TakeSnapshot(casterSlot);
+        if (snap.lastTarget && snap.targetScale != 0) {
+            g_pendingResets.push_back({ snap.lastTarget, snap.targetScale });
         }
 
-        if (snap.lastTarget) {
-            for (auto node : snap.targetScale) {
-                FB::Scaler::SetNodeScale(snap.lastTarget, node, 1.0f, logOps);
-            }
+        std::lock_guard _{ g_stateMutex };
+        GetStateLocked(casterSlot).lastTarget = {};
+    }
 
-            if (resetMorphTarget) {
-                FB::Morph::ResetAllForActor(snap.lastTarget, logOps);
-            }
+    void ForgetAll()
+    {
+        AssertGameThread();
+
+        {
+            std::lock_guard _{ g_inboxMutex };
+            g_inbox.clear();
         }
 
-        if (logOps) {
-            auto c = caster.get();
-            spdlog::info("[FB] Reset: caster='{}' casterNodes={} targetNodes={} resetMorphCaster={} resetMorphTarget={}",
-                c ? c->GetName() : "<null>",
-                snap.casterScale.size(),
-                snap.targetScale.size(),
-                resetMorphCaster,
-                resetMorphTarget);
+        g_activeTimelines.clear();
+        g_timelineBySlot.fill(kNoTimeline);
+        g_activeTweens.clear();
+        g_scaleTweens.clear();
+        g_pendingResets.clear();
+
+        // Moving every generation on also stops anything still holding an old token
+        std::lock_guard _{ g_stateMutex };
+        for (auto& st : g_casters) {
+            st.lastTarget = {};
+            st.casterTouchedScale = 0;
+            st.targetTouchedScale = 0;
+            st.casterTouchedMorph = false;
+            st.targetTouchedMorph = false;
+            st.generation.fetch_add(1, std::memory_order_acq_rel);
         }
     }
 }
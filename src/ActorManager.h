@@ -2,7 +2,12 @@
 
 #include "RE/Skyrim.h"
 
+#include "FBActorRegistry.h"  // FB::ActorRegistry::Slot
+#include "FBMorph.h"          // FB::Morph::MorphId
+#include "FBScaler.h"         // FB::Scaler::NodeId
+
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -15,13 +20,17 @@ namespace FB
         kTarget
     };
 
-    enum class CommandKind
+    enum class CommandKind : std::uint8_t
     {
         kScale,
         kMorph,
-        kHide
+        kHide,
+
+        kCount
     };
 
+    inline constexpr std::size_t kCommandKindCount = static_cast<std::size_t>(CommandKind::kCount);
+
     enum class TweenCurve
     {
         kLinear
@@ -41,14 +50,15 @@ namespace FB
         float       timeSeconds{ 0.0f };
 
         // Scale payload (valid when kind==kScale)
-        std::string_view nodeKey{};
-        float            scale{ 1.0f };
+        FB::Scaler::NodeId node{ FB::Scaler::NodeId::kHead };
+        float              scale{ 1.0f };
 
         // Morph payload (valid when kind==kMorph)
-        std::string morphName{};
+        // Interned by FBConfig (FB::Morph::InternMorph), so copies are a 16-bit ID.
+        FB::Morph::MorphId morph{ FB::Morph::kInvalidMorphId };
         float       delta{ 0.0f };
 
-        // Tween payload (optional; used only when kind==kMorph)
+        // Tween payload (optional; kMorph and kScale)
         float tweenSeconds{ 0.0f };
         TweenCurve tweenCurve{ TweenCurve::kLinear };
 
@@ -58,27 +68,110 @@ namespace FB
         bool          hide{ false };
     };
 
+    // ------------------------------------------------------------
+    // Compiled timeline (runtime form)
+    // TimedCommand is the parser's intermediate; FBConfig compiles each timeline into one
+    // time-sorted, tightly packed array per command kind so the runtime never branches on kind.
+    // ------------------------------------------------------------
+    struct ScaleEvent
+    {
+        float              timeSeconds{ 0.0f };
+        FB::Scaler::NodeId node{ FB::Scaler::NodeId::kHead };
+        TargetKind         target{ TargetKind::kCaster };
+        float              scale{ 1.0f };
+        float              tweenSeconds{ 0.0f };  // > 0 => tween from the current scale instead of instant set
+    };
+
+    struct MorphEvent
+    {
+        float            timeSeconds{ 0.0f };
+        TargetKind       target{ TargetKind::kCaster };
+        TweenCurve       tweenCurve{ TweenCurve::kLinear };
+        FB::Morph::MorphId morph{ FB::Morph::kInvalidMorphId };
+        float            delta{ 0.0f };
+        float            tweenSeconds{ 0.0f };  // > 0 => schedule a tween instead of instant apply
+    };
+
+    struct HideEvent
+    {
+        float         timeSeconds{ 0.0f };
+        TargetKind    target{ TargetKind::kCaster };
+        HideMode      hideMode{ HideMode::kAll };
+        std::uint16_t hideSlot{ 0 };  // valid when hideMode==Slot
+        bool          hide{ false };
+    };
+
+    // One entry of the dispatch stream: which payload array, and where in it.
+    struct CommandRef
+    {
+        float         timeSeconds{ 0.0f };
+        CommandKind   kind{ CommandKind::kScale };
+        std::uint32_t index{ 0 };
+    };
 
+    // Immutable once published; shared by the config snapshot and every ActiveTimeline running it.
+    struct CompiledTimeline
+    {
+        std::vector<ScaleEvent> scales;
+        std::vector<MorphEvent> morphs;
+        std::vector<HideEvent>  hides;
+
+        // Every command in time order (authored order kept for equal times); the runtime walks this
+        // with one cursor and dispatches each entry through a kind-indexed handler table.
+        std::vector<CommandRef> order;
+
+        std::size_t CommandCount() const noexcept { return order.size(); }
+        bool Empty() const noexcept { return order.empty(); }
+    };
+
+    using TimelinePtr = std::shared_ptr<const CompiledTimeline>;
 
     namespace ActorManager
     {
         // Start a deterministic timeline for a caster/target pair.
         // Commands include their own TargetKind (caster/target) and timeSeconds.
+        // The timeline is shared, not copied: starting one is O(1) regardless of its length.
+        // With syncClip (an animation file name) the timeline follows that clip's local time on the
+        // caster's graph while it is playing, and falls back to frame time when it is not found.
+        // Any thread: the start is queued and takes effect at the top of the next Update.
         void StartTimeline(
             RE::ActorHandle caster,
             RE::ActorHandle target,
-            std::uint32_t casterFormID,
-            std::vector<FB::TimedCommand> commands,
-            bool logOps);
-
-        // Cancel current work for casterFormID/token lineage and optionally reset morphs.
+            FB::ActorRegistry::Slot casterSlot,
+            FB::TimelinePtr timeline,
+            bool logOps,
+            std::string_view syncClip = {});
+
+        // Move the caster's running timeline to timeSeconds (scrub, or re-sync to the animation's local
+        // time). The new cursor is found by binary search over the time-sorted commands.
+        // Seeking forward with runSkipped fires the commands in between now (their tweens start
+        // part-way through, as if started on time); otherwise they are skipped. Seeking backward
+        // re-arms the commands after timeSeconds, which fire again as playback passes them; morph
+        // commands are additive, so those that already applied their delta are not applied again.
+        // Returns false if the caster has no running timeline. Game thread.
+        bool SeekTimeline(FB::ActorRegistry::Slot casterSlot, float timeSeconds, bool runSkipped);
+
+        // Cancel current work for the caster's token lineage, restore the scales and hides it applied on
+        // the caster and its last target, and optionally reset morphs.
+        // casterSlot may be invalid (caster never registered): only the caster's hide and morph resets run then.
+        // Any thread: queued behind earlier starts and applied at the top of the next Update.
         void CancelAndReset(
             RE::ActorHandle caster,
-            std::uint32_t casterFormID,
+            FB::ActorRegistry::Slot casterSlot,
             bool logOps,
             bool resetMorphCaster,
             bool resetMorphTarget);
 
+        // The caster's actor unloaded: drop its timeline, tweens and ownership state (its slot is
+        // about to be reclaimed) and restore the nodes it scaled on its last target. The restore is
+        // low-priority work: it goes out with the next Update that has frame budget to spare.
+        // Game thread (TESObjectLoadedEvent is dispatched there).
+        void ForgetActor(FB::ActorRegistry::Slot casterSlot);
+
+        // New game / save loaded: drop every timeline, tween, queued request and ownership state
+        // without restoring anything (the loaded game has its own). Game thread.
+        void ForgetAll();
+
         // Deterministic tick entry point. Called by your PlayerCharacter::Update hook/pump.
         void Update(float dtSeconds);
     }
@@ -13,8 +13,14 @@
 #include "AnimationEvents.h"
 
 #include "ActorManager.h"
+#include "FBActorRegistry.h"
 #include "FBConfig.h"
+#include "FBFrameClock.h"
+#include "FBHide.h"
+#include "FBMorph.h"
 #include "FBScaler.h"
+#include "FBStats.h"
+#include "FBTargetIndex.h"
 
 #include "RE/Skyrim.h"
 #include "SKSE/SKSE.h"
@@ -22,6 +28,8 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cctype>
@@ -31,6 +39,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -62,164 +71,160 @@ namespace
 		return i == a.size() && b[i] == '\0';
 	}
 
-	// =========================
-	// Node mapping (stays here)
-	// =========================
-	static std::optional<std::string_view> ResolveNodeKey(std::string_view key)
-	{
-		// Author-facing NodeKey -> skeleton NiNode name mapping.
-		// Keep these keys stable; they are part of the INI "public API".
-
-		// Head / Neck
-		if (key == "Head") return FB::Scaler::kNodeHead;
-		if (key == "Neck") return FB::Scaler::kNodeNeck;
-
-		// Spine
-		if (key == "Spine0") return FB::Scaler::kNodeSpine0;
-		if (key == "Spine1") return FB::Scaler::kNodeSpine1;
-		if (key == "Spine2") return FB::Scaler::kNodeSpine2;
-		if (key == "Spine3") return FB::Scaler::kNodeSpine3;
-
-		// Pelvis
-		if (key == "Pelvis") return FB::Scaler::kNodePelvis;
-
-		// Arms
-		if (key == "LClavicle") return FB::Scaler::kNodeLClavicle;
-		if (key == "RClavicle") return FB::Scaler::kNodeRClavicle;
-		if (key == "LUpperArm") return FB::Scaler::kNodeLUpperArm;
-		if (key == "RUpperArm") return FB::Scaler::kNodeRUpperArm;
-		if (key == "LForearm") return FB::Scaler::kNodeLForearm;
-		if (key == "RForearm") return FB::Scaler::kNodeRForearm;
-		if (key == "LHand") return FB::Scaler::kNodeLHand;
-		if (key == "RHand") return FB::Scaler::kNodeRHand;
-
-		// Legs
-		if (key == "LThigh") return FB::Scaler::kNodeLThigh;
-		if (key == "RThigh") return FB::Scaler::kNodeRThigh;
-		if (key == "LCalf") return FB::Scaler::kNodeLCalf;
-		if (key == "RCalf") return FB::Scaler::kNodeRCalf;
-		if (key == "LFoot") return FB::Scaler::kNodeLFoot;
-		if (key == "RFoot") return FB::Scaler::kNodeRFoot;
-		if (key == "LToe0") return FB::Scaler::kNodeLToe0;
-		if (key == "RToe0") return FB::Scaler::kNodeRToe0;
-
-		// Legacy convenience keys
-		if (key == "Spine") return FB::Scaler::kNodeSpine0;
-
-		return std::nullopt;
-	}
-
 	// =========================
 	// Debounce (event-level)
 	// =========================
-	static std::mutex g_debounceMutex;
-	static std::unordered_map<std::uint32_t, std::chrono::steady_clock::time_point> g_lastStart;
+	// One stamp per FB::ActorRegistry slot: the game time (FB::FrameClock) of the caster's last start,
+	// tagged with the low bits of the slot generation so a reused slot never debounces its new actor.
+	// 0 = never started. Lock-free: a compare plus one CAS.
+	static constexpr std::uint32_t kStampTimeBits = 48;
+	static constexpr std::uint64_t kStampTimeMask = (std::uint64_t{ 1 } << kStampTimeBits) - 1;
+	static constexpr FB::FrameClock::Ticks kStartDebounceTicks = FB::FrameClock::FromSeconds(kStartDebounceSeconds);
 
-	static bool ShouldDebounceStart(std::uint32_t casterFormID)
-	{
-		std::lock_guard _{ g_debounceMutex };
-
-		const auto now = std::chrono::steady_clock::now();
-		auto& last = g_lastStart[casterFormID];
+	static std::array<std::atomic<std::uint64_t>, FB::ActorRegistry::kCapacity> g_lastStart{};
 
-		if (last.time_since_epoch().count() != 0) {
-			const float dt = std::chrono::duration<float>(now - last).count();
-			if (dt < kStartDebounceSeconds) {
+	static bool ShouldDebounceStart(FB::ActorRegistry::Slot casterSlot)
+	{
+		const auto now = FB::FrameClock::Now();
+		const std::uint64_t tag = static_cast<std::uint64_t>(casterSlot.generation) << kStampTimeBits;
+		const std::uint64_t stamp = tag | ((now + 1) & kStampTimeMask);
+
+		auto& last = g_lastStart[casterSlot.index];
+		auto prev = last.load(std::memory_order_relaxed);
+		do {
+			const bool sameActor = prev != 0 && (prev & ~kStampTimeMask) == tag;
+			if (sameActor && now + 1 - (prev & kStampTimeMask) < kStartDebounceTicks) {
 				return true;
 			}
-		}
+		} while (!last.compare_exchange_weak(prev, stamp, std::memory_order_relaxed));
 
-		last = now;
 		return false;
 	}
 
 	// =========================
 	// Target resolution
 	// =========================
+	// Same gates the original full scan used: alive, 3D loaded, same cell as the caster.
+	static bool IsEligibleTarget(const RE::Actor* caster, const RE::TESObjectCELL* casterCell, RE::Actor* a)
+	{
+		if (!a || a == caster) {
+			return false;
+		}
+		if (a->IsDead()) {
+			return false;
+		}
+		if (!a->Is3DLoaded()) {
+			return false;
+		}
+		if (casterCell && a->GetParentCell() != casterCell) {
+			return false;
+		}
+		return true;
+	}
+
+	static float DistanceSq(const RE::NiPoint3& a, const RE::NiPoint3& b)
+	{
+		const auto d = a - b;
+		return (d.x * d.x) + (d.y * d.y) + (d.z * d.z);
+	}
+
 	static RE::ActorHandle FindLikelyPairedTarget(RE::Actor* caster, bool log)
 	{
 		if (!caster) {
 			return {};
 		}
 
-		auto casterPos = caster->GetPosition();
+		FB_STATS_TIMER(kTargetResolve);
 
-		RE::Actor* best = nullptr;
-		float bestDist2 = kTargetSearchRadius * kTargetSearchRadius;
-
-		auto* processLists = RE::ProcessLists::GetSingleton();
-		if (!processLists) {
-			return {};
-		}
+		const auto startTime = log ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
 
+		const auto casterPos = caster->GetPosition();
 		auto* casterCell = caster->GetParentCell();
 
-		processLists->ForEachHighActor([&](RE::Actor& a) {
-			RE::Actor* ap = std::addressof(a);
+		RE::NiPointer<RE::Actor> best;
+		float bestDist2 = kTargetSearchRadius * kTargetSearchRadius;
+		std::size_t scanned = 0;
+		const char* path = "partner";
 
-			if (!ap || ap == caster) {
-				return RE::BSContainer::ForEachResult::kContinue;
-			}
-			if (ap->IsDead()) {
-				return RE::BSContainer::ForEachResult::kContinue;
+		const auto consider = [&](RE::NiPointer<RE::Actor> a) {
+			++scanned;
+			if (!IsEligibleTarget(caster, casterCell, a.get())) {
+				return;
 			}
-			if (!ap->Is3DLoaded()) {
-				return RE::BSContainer::ForEachResult::kContinue;
-			}
-			if (casterCell && ap->GetParentCell() != casterCell) {
-				return RE::BSContainer::ForEachResult::kContinue;
-			}
-
-			auto d = ap->GetPosition() - casterPos;
-			const float dist2 = (d.x * d.x) + (d.y * d.y) + (d.z * d.z);
+			const float dist2 = DistanceSq(a->GetPosition(), casterPos);
 			if (dist2 < bestDist2) {
 				bestDist2 = dist2;
-				best = ap;
+				best = std::move(a);
 			}
+		};
 
-			return RE::BSContainer::ForEachResult::kContinue;
-			});
+		// 1) Engine partner: kill moves and combat paired idles play against the combat target.
+		consider(caster->GetActorRuntimeData().currentCombatTarget.get());
 
-		if (best) {
-			if (log) {
-				spdlog::info("[FB] TargetResolve: caster='{}' -> target='{}' dist={}",
-					caster->GetName(), best->GetName(), std::sqrt(bestDist2));
+		// 2) Nearest actor from the cell-bucketed index (only the caster's neighbourhood)
+		if (!best) {
+			thread_local std::vector<RE::ActorHandle> candidates;
+			candidates.clear();
+
+			if (FB::TargetIndex::Query(casterCell, casterPos, kTargetSearchRadius, candidates)) {
+				path = "index";
+				for (const auto& h : candidates) {
+					consider(h.get());
+				}
+			}
+			// 3) Index not built yet (first frames after load): full high-actor scan
+			else if (auto* processLists = RE::ProcessLists::GetSingleton()) {
+				path = "scan";
+				processLists->ForEachHighActor([&](RE::Actor& a) {
+					consider(RE::NiPointer<RE::Actor>(std::addressof(a)));
+					return RE::BSContainer::ForEachResult::kContinue;
+					});
 			}
-			return best->CreateRefHandle();
 		}
 
 		if (log) {
-			spdlog::info("[FB] TargetResolve: caster='{}' -> no target found", caster->GetName());
+			const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+			if (best) {
+				spdlog::info("[FB] TargetResolve: caster='{}' -> target='{}' dist={} path={} scanned={} latency={}us",
+					caster->GetName(), best->GetName(), std::sqrt(bestDist2), path, scanned, us);
+			}
+			else {
+				spdlog::info("[FB] TargetResolve: caster='{}' -> no target found path={} scanned={} latency={}us",
+					caster->GetName(), path, scanned, us);
+			}
 		}
-		return {};
+
+		return best ? best->CreateRefHandle() : RE::ActorHandle{};
 	}
 
 	// =========================
 	// Timeline start + dispatch
 	// =========================
-	static void StartTimelineForCaster(RE::Actor* caster, std::string_view startEventTag)
+	static void StartTimelineForCaster(
+		RE::Actor* caster,
+		std::string_view startEventTag,
+		const FB::Config::ConfigData& cfg,
+		const FB::Config::StartEvent& start)
 	{
 		if (!caster) {
 			return;
 		}
 
-		const auto& cfg = FB::Config::Get(&ResolveNodeKey);
-
-		if (!cfg.enableTimelines) {
+		// The filter only holds mapped tags with non-empty timelines (and is empty when timelines are disabled),
+		// so we get here with the timeline already resolved. Lazy timelines compile here on first use.
+		const auto commands = start.Commands();
+		if (!commands || commands->Empty()) {
 			return;
 		}
 
-		// 1) Only proceed if this tag is mapped
-		auto itMap = cfg.eventToTimeline.find(std::string(startEventTag));
-		if (itMap == cfg.eventToTimeline.end()) {
+		// One registry lookup serves debounce, ownership and every per-actor table downstream
+		const auto casterSlot = FB::ActorRegistry::Acquire(caster->GetFormID());
+		if (!casterSlot.Valid()) {
 			return;
 		}
 
-		const std::string_view timelineName{ itMap->second };
-
-		// 2) Debounce only real starts
-		const std::uint32_t casterFormID = caster->GetFormID();
-		if (ShouldDebounceStart(casterFormID)) {
+		// 1) Debounce only real starts
+		if (ShouldDebounceStart(casterSlot)) {
 			if (cfg.dbg.logOps) {
 				spdlog::info("[FB] Debounce: ignoring start '{}' on '{}'",
 					std::string(startEventTag), caster->GetName());
@@ -227,44 +232,33 @@ namespace
 			return;
 		}
 
-		// 3) Retrieve timeline commands
-		auto itTL = cfg.timelines.find(std::string(timelineName));
-		if (itTL == cfg.timelines.end() || itTL->second.empty()) {
-			if (cfg.dbg.logOps) {
-				spdlog::info("[FB] Timeline '{}' has no commands", std::string(timelineName));
-			}
-			return;
-		}
-
 		auto targetHandle = FindLikelyPairedTarget(caster, cfg.dbg.logTargetResolve);
 
 		if (cfg.dbg.logOps && cfg.dbg.logTimelineStart) {
 			auto t = targetHandle.get();
 			spdlog::info("[FB] StartTimeline: tag='{}' timeline='{}' caster='{}' target='{}' cmds={}",
 				std::string(startEventTag),
-				std::string(timelineName),
+				start.timeline,
 				caster->GetName(),
 				t ? t->GetName() : "<none>",
-				itTL->second.size());
+				commands->CommandCount());
 		}
 
 		FB::ActorManager::StartTimeline(
 			caster->CreateRefHandle(),
 			targetHandle,
-			casterFormID,
-			itTL->second,
-			cfg.dbg.logOps);
+			casterSlot,
+			commands,
+			cfg.dbg.logOps,
+			cfg.syncToClipTime ? std::string_view(start.timeline) : std::string_view{});
 	}
 
-	static void CancelAndReset(RE::Actor* caster, std::string_view tag)
+	static void CancelAndReset(RE::Actor* caster, std::string_view tag, const FB::Config::ConfigData& cfg)
 	{
 		if (!caster) {
 			return;
 		}
 
-		const auto& cfg = FB::Config::Get(&ResolveNodeKey);
-		const std::uint32_t casterFormID = caster->GetFormID();
-
 		const bool isPairEnd = (tag == kPairEndEvent);
 		const bool isPairedStop = (tag == kPairedStopEvent);
 
@@ -274,7 +268,7 @@ namespace
 
 		FB::ActorManager::CancelAndReset(
 			caster->CreateRefHandle(),
-			casterFormID,
+			FB::ActorRegistry::Find(caster->GetFormID()),
 			cfg.dbg.logOps,
 			/*resetMorphsForCaster=*/doMorphReset,
 			/*resetMorphsForTarget=*/doMorphReset);
@@ -295,30 +289,35 @@ namespace
 				return RE::BSEventNotifyControl::kContinue;
 			}
 
+			FB_STATS_TIMER(kEventSink);
+
 			auto* caster = const_cast<RE::Actor*>(a_event->holder->As<RE::Actor>());
 			if (!caster) {
 				return RE::BSEventNotifyControl::kContinue;
 			}
 
 			const std::string_view tag{ a_event->tag.c_str(), a_event->tag.size() };
-			const auto& cfg = FB::Config::Get(&ResolveNodeKey);
+
+			// Lock-free snapshot; stays valid for this callback even if a reload swaps in a new one.
+			const auto cfg = FB::Config::Get(&FB::Scaler::ResolveNodeKey);
 
 			// Stop events -> cancel + reset
-			if ((cfg.resetOnPairEnd && tag == kPairEndEvent) ||
-				(cfg.resetOnPairedStop && tag == kPairedStopEvent)) {
+			if ((cfg->resetOnPairEnd && tag == kPairEndEvent) ||
+				(cfg->resetOnPairedStop && tag == kPairedStopEvent)) {
 
-				if (cfg.dbg.logOps) {
+				if (cfg->dbg.logOps) {
 					spdlog::info("[FB] '{}' on '{}' -> cancel + reset",
 						std::string(tag), caster->GetName());
 				}
 
-				CancelAndReset(caster, tag);
+				CancelAndReset(caster, tag, *cfg);
 				return RE::BSEventNotifyControl::kContinue;
 			}
 
-			// Start events based on EventToTimeline mapping
-			if (cfg.eventToTimeline.contains(std::string(tag))) {
-				StartTimelineForCaster(caster, tag);
+			// Start events based on EventToTimeline mapping.
+			// Hot path: most tags (footsteps, SoundPlay, weapon swings) end here with no lock and no allocation.
+			if (const auto* start = cfg->startEvents.Find(tag)) {
+				StartTimelineForCaster(caster, tag, *cfg, *start);
 			}
 
 			return RE::BSEventNotifyControl::kContinue;
@@ -326,6 +325,158 @@ namespace
 	};
 
 	AnimationEventSink g_animationEventSink;
+
+	// =========================
+	// Sink registration table
+	// =========================
+	// One entry per actor whose graphs carry our sink, sorted by formID. We keep the graph manager
+	// alive so the sink can still be detached from the same graphs when the actor's 3D unloads.
+	struct SinkRegistration
+	{
+		std::uint32_t formID{ 0 };
+		RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+	};
+
+	// Actors whose 3D loaded before their graphs existed; retried from the update pump.
+	struct PendingSink
+	{
+		std::uint32_t formID{ 0 };
+		std::uint16_t attempts{ 0 };
+	};
+
+	// ~2 seconds of frames; graphs normally appear within a frame or two of the 3D.
+	static constexpr std::uint16_t kMaxSinkRetries = 120;
+
+	std::mutex g_registryMutex;
+	std::vector<SinkRegistration> g_registrations;
+	std::vector<PendingSink> g_pendingSinks;
+	std::atomic_bool g_hasPendingSinks{ false };
+
+	// Caller holds g_registryMutex
+	static std::vector<SinkRegistration>::iterator FindRegistrationLocked(std::uint32_t formID)
+	{
+		return std::ranges::lower_bound(g_registrations, formID, {}, &SinkRegistration::formID);
+	}
+
+	static void DetachLocked(const SinkRegistration& reg)
+	{
+		if (!reg.manager) {
+			return;
+		}
+
+		for (auto& graph : reg.manager->graphs) {
+			if (graph) {
+				graph->RemoveEventSink(&g_animationEventSink);
+			}
+		}
+	}
+
+	// Caller holds g_registryMutex. Returns the number of graphs the sink is now attached to.
+	static std::size_t AttachLocked(RE::Actor* actor)
+	{
+		RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+		if (!actor->GetAnimationGraphManager(manager) || !manager) {
+			return 0;
+		}
+
+		std::size_t attached = 0;
+		for (auto& graph : manager->graphs) {
+			if (!graph) continue;
+			graph->AddEventSink(&g_animationEventSink);
+			++attached;
+		}
+
+		if (attached == 0) {
+			return 0;
+		}
+
+		const auto formID = actor->GetFormID();
+		auto it = FindRegistrationLocked(formID);
+		if (it != g_registrations.end() && it->formID == formID) {
+			// Re-registration: the 3D (and with it the graphs) may have been rebuilt.
+			if (it->manager.get() != manager.get()) {
+				DetachLocked(*it);
+			}
+			it->manager = std::move(manager);
+		}
+		else {
+			g_registrations.insert(it, SinkRegistration{ formID, std::move(manager) });
+		}
+
+		return attached;
+	}
+
+	static void RemovePendingLocked(std::uint32_t formID)
+	{
+		std::erase_if(g_pendingSinks, [formID](const PendingSink& p) { return p.formID == formID; });
+		g_hasPendingSinks.store(!g_pendingSinks.empty(), std::memory_order_release);
+	}
+
+	static void AddPendingLocked(std::uint32_t formID)
+	{
+		for (const auto& p : g_pendingSinks) {
+			if (p.formID == formID) {
+				return;
+			}
+		}
+
+		g_pendingSinks.push_back({ formID, 0 });
+		g_hasPendingSinks.store(true, std::memory_order_release);
+	}
+
+	// Attach now, or queue for the pump if the graphs are not built yet.
+	static void AttachOrDefer(RE::Actor* actor)
+	{
+		std::lock_guard _{ g_registryMutex };
+		if (AttachLocked(actor) > 0) {
+			RemovePendingLocked(actor->GetFormID());
+		}
+		else {
+			AddPendingLocked(actor->GetFormID());
+		}
+	}
+
+	// =========================
+	// Actor load/unload sink
+	// =========================
+	class ActorLoadSink : public RE::BSTEventSink<RE::TESObjectLoadedEvent>
+	{
+	public:
+		RE::BSEventNotifyControl ProcessEvent(
+			const RE::TESObjectLoadedEvent* a_event,
+			RE::BSTEventSource<RE::TESObjectLoadedEvent>*)
+			override
+		{
+			if (!a_event) {
+				return RE::BSEventNotifyControl::kContinue;
+			}
+
+			if (!a_event->loaded) {
+				UnregisterAnimationEventSink(a_event->formID);
+
+				// Cached skeleton nodes and geometry belong to the 3D that just went away.
+				FB::Scaler::InvalidateNodeCache(a_event->formID);
+
+				// Per-actor state lives in registry slots: drop each table's entry, then reclaim the slot.
+				if (const auto slot = FB::ActorRegistry::Find(a_event->formID); slot.Valid()) {
+					FB::ActorManager::ForgetActor(slot);
+					FB::Hide::ForgetActor(slot);
+					FB::Morph::ForgetActor(slot);
+					FB::ActorRegistry::Release(slot);
+				}
+				return RE::BSEventNotifyControl::kContinue;
+			}
+
+			// Fires for every reference; only actors have graphs we care about.
+			if (auto* actor = RE::TESForm::LookupByID<RE::Actor>(a_event->formID)) {
+				AttachOrDefer(actor);
+			}
+
+			return RE::BSEventNotifyControl::kContinue;
+		}
+	};
+
+	ActorLoadSink g_actorLoadSink;
 }  // namespace
 
 // =========================
@@ -335,33 +486,102 @@ bool RegisterAnimationEventSink(RE::Actor* actor)
 {
 	if (!actor) return false;
 
-	RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
-	if (!actor->GetAnimationGraphManager(manager) || !manager) {
-		spdlog::warn("RegisterAnimationEventSink: no animation graph manager");
-		return false;
-	}
-
-	bool attached = false;
-	for (auto& graph : manager->graphs) {
-		if (!graph) continue;
-		graph->AddEventSink(&g_animationEventSink);
-		attached = true;
+	std::size_t attached = 0;
+	{
+		std::lock_guard _{ g_registryMutex };
+		attached = AttachLocked(actor);
 	}
 
-	if (attached) {
+	if (attached > 0) {
 		spdlog::info("Registered animation sinks to actor={}", actor->GetName());
 	}
 	else {
 		spdlog::warn("RegisterAnimationEventSink: no graphs for actor={}", actor->GetName());
 	}
 
-	return attached;
+	return attached > 0;
+}
+
+void UnregisterAnimationEventSink(std::uint32_t actorFormID)
+{
+	std::lock_guard _{ g_registryMutex };
+	RemovePendingLocked(actorFormID);
+
+	auto it = FindRegistrationLocked(actorFormID);
+	if (it == g_registrations.end() || it->formID != actorFormID) {
+		return;
+	}
+
+	DetachLocked(*it);
+	g_registrations.erase(it);
+}
+
+void InstallActorLoadSink()
+{
+	auto* holder = RE::ScriptEventSourceHolder::GetSingleton();
+	if (!holder) {
+		spdlog::warn("[FB] InstallActorLoadSink: event source holder not available");
+		return;
+	}
+
+	holder->AddEventSink<RE::TESObjectLoadedEvent>(&g_actorLoadSink);
+	spdlog::info("[FB] Actor load sink installed");
+}
+
+void RegisterLoadedActors()
+{
+	auto* lists = RE::ProcessLists::GetSingleton();
+	if (!lists) {
+		return;
+	}
+
+	std::size_t count = 0;
+	for (auto& handle : lists->highActorHandles) {
+		if (auto actor = handle.get(); actor && actor->Is3DLoaded()) {
+			AttachOrDefer(actor.get());
+			++count;
+		}
+	}
+
+	if (auto* player = RE::PlayerCharacter::GetSingleton()) {
+		AttachOrDefer(player);
+		++count;
+	}
+
+	std::lock_guard _{ g_registryMutex };
+	spdlog::info("[FB] Registered loaded actors: seen={} registered={} pending={}",
+		count, g_registrations.size(), g_pendingSinks.size());
+}
+
+void RetryPendingAnimationEventSinks()
+{
+	if (!g_hasPendingSinks.load(std::memory_order_acquire)) {
+		return;
+	}
+
+	std::lock_guard _{ g_registryMutex };
+	std::erase_if(g_pendingSinks, [](PendingSink& p) {
+		auto* actor = RE::TESForm::LookupByID<RE::Actor>(p.formID);
+		if (!actor || !actor->Is3DLoaded()) {
+			return true;
+		}
+		if (AttachLocked(actor) > 0) {
+			return true;
+		}
+		if (++p.attempts >= kMaxSinkRetries) {
+			spdlog::warn("[FB] Giving up on animation sink for actor={} (no graphs after {} frames)",
+				actor->GetName(), p.attempts);
+			return true;
+		}
+		return false;
+		});
+	g_hasPendingSinks.store(!g_pendingSinks.empty(), std::memory_order_release);
 }
 
 
 void LoadFBConfig()
 {
-	FB::Config::Reload(&ResolveNodeKey);
+	FB::Config::Reload(&FB::Scaler::ResolveNodeKey);
 }
 
 
@@ -371,6 +591,6 @@ void HeadScale(RE::Actor* actor, float scale)
 		return;
 	}
 
-	const auto& cfg = FB::Config::Get(&ResolveNodeKey);
-	FB::Scaler::SetNodeScale(actor->CreateRefHandle(), FB::Scaler::kNodeHead, scale, cfg.dbg.logOps);
+	const auto cfg = FB::Config::Get(&FB::Scaler::ResolveNodeKey);
+	FB::Scaler::SetNodeScale(actor->CreateRefHandle(), FB::Scaler::NodeId::kHead, scale, cfg->dbg.logOps);
 }
@@ -1,8 +1,26 @@
 #pragma once
 
+#include <cstdint>
+
 namespace RE
 {
 	class Actor;
 }
 
+// Attach our sink to every behavior graph of actor (idempotent; re-attaches if the graphs changed).
 bool RegisterAnimationEventSink(RE::Actor* actor); 
+
+// Detach our sink from the graphs actor was registered with and forget the registration.
+void UnregisterAnimationEventSink(std::uint32_t actorFormID);
+
+// Attach/detach sinks as actors' 3D loads/unloads (TESObjectLoadedEvent). Install once at kDataLoaded.
+void InstallActorLoadSink();
+
+// Register every actor that is already loaded (after a save load / new game, when no load events fire for them).
+void RegisterLoadedActors();
+
+// Retry actors whose graphs were not ready when their 3D loaded. Called from the update pump; no-op when none are pending.
+void RetryPendingAnimationEventSinks();
+
+// Load (or reload) FullBodiedIni.ini with this module's NodeKey resolver.
+void LoadFBConfig();
@@ -0,0 +1,121 @@
+#include "FBActorRegistry.h"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	struct Entry
+	{
+		std::atomic<std::uint32_t> generation{ 1 };
+		std::uint32_t formID{ 0 };  // guarded by g_mutex; 0 = free
+	};
+
+	std::array<Entry, FB::ActorRegistry::kCapacity> g_entries;
+
+	// Writers: Acquire (first use), Release, Clear. Readers: Acquire/Find of already-registered actors.
+	std::shared_mutex g_mutex;
+	std::unordered_map<std::uint32_t, std::uint32_t> g_indexByFormID;
+	std::vector<std::uint32_t> g_free;     // reclaimed indices, reused LIFO (the most recently touched memory)
+	std::uint32_t g_highWater = 0;        // indices below this have been issued at least once
+	bool g_loggedFull = false;
+
+	// Caller holds g_mutex (exclusive)
+	static void ReleaseLocked(std::uint32_t index)
+	{
+		auto& e = g_entries[index];
+		g_indexByFormID.erase(e.formID);
+		e.formID = 0;
+		e.generation.fetch_add(1, std::memory_order_acq_rel);
+		g_free.push_back(index);
+	}
+}
+
+namespace FB::ActorRegistry
+{
+	Slot Acquire(std::uint32_t formID)
+	{
+		if (formID == 0) {
+			return {};
+		}
+
+		if (const auto slot = Find(formID); slot.Valid()) {
+			return slot;
+		}
+
+		std::unique_lock lk(g_mutex);
+		if (const auto it = g_indexByFormID.find(formID); it != g_indexByFormID.end()) {
+			return { it->second, g_entries[it->second].generation.load(std::memory_order_relaxed) };
+		}
+
+		std::uint32_t index = kInvalidIndex;
+		if (!g_free.empty()) {
+			index = g_free.back();
+			g_free.pop_back();
+		}
+		else if (g_highWater < kCapacity) {
+			index = g_highWater++;
+		}
+		else {
+			if (!std::exchange(g_loggedFull, true)) {
+				spdlog::warn("[FB] ActorRegistry: all {} slots in use; actor {:08X} is not tracked", kCapacity, formID);
+			}
+			return {};
+		}
+
+		auto& e = g_entries[index];
+		e.formID = formID;
+		g_indexByFormID.emplace(formID, index);
+		return { index, e.generation.load(std::memory_order_relaxed) };
+	}
+
+	Slot Find(std::uint32_t formID)
+	{
+		std::shared_lock lk(g_mutex);
+		const auto it = g_indexByFormID.find(formID);
+		if (it == g_indexByFormID.end()) {
+			return {};
+		}
+		return { it->second, g_entries[it->second].generation.load(std::memory_order_relaxed) };
+	}
+
+	bool IsCurrent(Slot slot)
+	{
+		return slot.index < kCapacity &&
+		       g_entries[slot.index].generation.load(std::memory_order_acquire) == slot.generation;
+	}
+
+	void Release(Slot slot)
+	{
+		std::unique_lock lk(g_mutex);
+		if (slot.index >= kCapacity || g_entries[slot.index].formID == 0 ||
+			g_entries[slot.index].generation.load(std::memory_order_relaxed) != slot.generation) {
+			return;
+		}
+		ReleaseLocked(slot.index);
+	}
+
+	void Clear()
+	{
+		std::unique_lock lk(g_mutex);
+		for (std::uint32_t i = 0; i < g_highWater; ++i) {
+			if (g_entries[i].formID != 0) {
+				ReleaseLocked(i);
+			}
+		}
+		g_loggedFull = false;
+	}
+
+	std::size_t Count()
+	{
+		std::shared_lock lk(g_mutex);
+		return g_indexByFormID.size();
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace FB::ActorRegistry
+{
+	// Central actor registry: every actor we keep state for gets one dense slot. Subsystems store their
+	// per-actor state in fixed arrays of kCapacity entries indexed by Slot::index (one formID lookup
+	// reaches all of them; storage never moves, so indices stay valid without a lock).
+	//
+	// Slots are reclaimed when the actor unloads (Release) and on save load (Clear); a reclaimed index
+	// is reissued with a new generation. Each subsystem entry remembers the generation it was filled
+	// for and starts over when handed a newer one, so a reused slot never inherits stale state.
+	inline constexpr std::uint32_t kCapacity = 1024;
+	inline constexpr std::uint32_t kInvalidIndex = UINT32_MAX;
+
+	struct Slot
+	{
+		std::uint32_t index{ kInvalidIndex };
+		std::uint32_t generation{ 0 };
+
+		bool Valid() const noexcept { return index != kInvalidIndex; }
+
+		bool operator==(const Slot&) const = default;
+	};
+
+	// Slot for formID, assigning one on first use. Invalid for formID 0 or when all slots are taken.
+	// Any thread.
+	Slot Acquire(std::uint32_t formID);
+
+	// Slot for formID if it already has one (never assigns). Any thread.
+	Slot Find(std::uint32_t formID);
+
+	// True while slot has not been reclaimed since it was issued. Lock-free.
+	bool IsCurrent(Slot slot);
+
+	// Reclaim slot (its actor unloaded). Subsystems drop their entry for it first. No-op if stale.
+	void Release(Slot slot);
+
+	// Reclaim every slot (new game / save load).
+	void Clear();
+
+	// Slots currently issued.
+	std::size_t Count();
+}
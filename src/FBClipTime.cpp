@@ -0,0 +1,60 @@
+#include "FBClipTime.h"
+#include "FBConfig.h"
+
+
+namespace
+{
+	// File-name part of an animation path ("Animations\\Paired\\paired_huga.hkx" -> "paired_huga.hkx")
+	static std::string_view FileName(std::string_view path)
+	{
+		const auto slash = path.find_last_of("\\/");
+		return slash == std::string_view::npos ? path : path.substr(slash + 1);
+	}
+
+	static std::optional<float> SampleGraph(const RE::BShkbAnimationGraph* graph, std::string_view clipName)
+	{
+		auto* behavior = graph->behaviorGraph;
+		if (!behavior || !behavior->activeNodes) {
+			return std::nullopt;
+		}
+
+		// Active nodes are the clones the graph is evaluating this frame; clip generators among them
+		// carry the playing animation's file and local time (playback speed already applied).
+		for (const auto& info : *behavior->activeNodes) {
+			auto* clip = skyrim_cast<RE::hkbClipGenerator*>(info.nodeClone);
+			if (!clip || !clip->animationName.data()) {
+				continue;
+			}
+
+			if (FB::Config::CaseFoldEqual{}(FileName(clip->animationName.data()), FileName(clipName))) {
+				return clip->localTime;
+			}
+		}
+		return std::nullopt;
+	}
+}
+
+namespace FB::ClipTime
+{
+	std::optional<float> Sample(RE::Actor* actor, std::string_view clipName)
+	{
+		if (!actor || clipName.empty()) {
+			return std::nullopt;
+		}
+
+		RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+		if (!actor->GetAnimationGraphManager(manager) || !manager) {
+			return std::nullopt;
+		}
+
+		for (const auto& graph : manager->graphs) {
+			if (!graph) {
+				continue;
+			}
+			if (auto t = SampleGraph(graph.get(), clipName)) {
+				return t;
+			}
+		}
+		return std::nullopt;
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <optional>
+#include <string_view>
+
+namespace FB::ClipTime
+{
+	// Clip-synced timelines ([General] SyncToClipTime): read where the animation actually is instead
+	// of integrating frame time, so playback-rate changes and late start events don't drift effects
+	// off the motion.
+
+	// Local time (seconds into the clip) of the clip generator currently active on actor's behavior
+	// graphs whose animation file name matches clipName (e.g. "paired_huga.hkx"; case-insensitive,
+	// directories ignored). nullopt if no such clip is playing, in which case callers keep their own
+	// clock. Game thread (reads live graph state).
+	std::optional<float> Sample(RE::Actor* actor, std::string_view clipName);
+}
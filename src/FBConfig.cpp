@@ -1,133 +1,182 @@
 #include "FBConfig.h"
+#include "FBConfigCache.h"
 #include "ActorManager.h"   // TargetKind / TimedCommand / CommandKind
-#include "FBMorph.h"        // (still included; not required anymore, but harmless)
+#include "FBMorph.h"        // InternMorph / SetNativeEnabled
+#include "FBScheduler.h"    // SetBudget / SetLod
+#include "FBStats.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 #include <charconv>
+#include <stop_token>
 #include <system_error>
+#include <thread>
 #include <cstdint>
-#include <charconv>
 
 namespace
 {
+	using FB::Config::CaseFoldEqual;
+
 	// Target line prefix standard (tokens inside [FB:...|Target] must be prefixed)
 	static constexpr std::string_view kTargetPrefix = "2_";
 
 	// -------------------------
 	// Small string utils
+	// All views: tokens point into the loaded file buffer, nothing is copied while parsing.
 	// -------------------------
-	static inline void TrimInPlace(std::string& s)
+	static constexpr bool IsSpace(unsigned char c)
 	{
-		auto notSpace = [](unsigned char c) { return !std::isspace(c); };
-		s.erase(s.begin(), std::find_if(s.begin(), s.end(), notSpace));
-		s.erase(std::find_if(s.rbegin(), s.rend(), notSpace).base(), s.end());
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
 	}
 
-	static inline void StripInlineComment(std::string& s)
+	static inline std::string_view Trim(std::string_view s)
 	{
-		auto p1 = s.find(';');
-		auto p2 = s.find('#');
-		auto p = std::min(p1 == std::string::npos ? s.size() : p1,
-			p2 == std::string::npos ? s.size() : p2);
-		if (p != std::string::npos && p < s.size()) {
-			s.resize(p);
+		while (!s.empty() && IsSpace(static_cast<unsigned char>(s.front()))) {
+			s.remove_prefix(1);
+		}
+		while (!s.empty() && IsSpace(static_cast<unsigned char>(s.back()))) {
+			s.remove_suffix(1);
 		}
+		return s;
 	}
 
-	static bool IEquals(std::string_view a, const char* b)
-	{
-		return IEquals(std::string(a), b);
-	}
-	static inline bool IEquals(const std::string& a, const char* b)
+	static inline std::string_view StripInlineComment(std::string_view s)
 	{
-		size_t i = 0;
-		for (; i < a.size() && b[i] != '\0'; ++i) {
-			char ca = static_cast<char>(std::tolower(static_cast<unsigned char>(a[i])));
-			char cb = static_cast<char>(std::tolower(static_cast<unsigned char>(b[i])));
-			if (ca != cb) {
-				return false;
-			}
-		}
-		return i == a.size() && b[i] == '\0';
+		const auto p = s.find_first_of(";#");
+		return p == std::string_view::npos ? s : s.substr(0, p);
 	}
 
-	static std::optional<float> ParseFloat(std::string s)
+	static std::optional<float> ParseFloat(std::string_view s)
 	{
-		TrimInPlace(s);
+		s = Trim(s);
+		if (!s.empty() && s.front() == '+') {
+			s.remove_prefix(1);
+		}
 		if (s.empty()) {
 			return std::nullopt;
 		}
-		char* end = nullptr;
-		const float f = std::strtof(s.c_str(), &end);
-		if (!end || end == s.c_str()) {
+
+		// Like strtof: a valid numeric prefix is enough
+		float f = 0.0f;
+		const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), f);
+		if (ec != std::errc() || ptr == s.data()) {
 			return std::nullopt;
 		}
 		return f;
 	}
 
-	static inline std::string ToLower(std::string s)
+	static std::optional<FB::TweenCurve> ParseTweenCurve(std::string_view s)
 	{
-		for (auto& ch : s) {
-			ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-		}
-		return s;
-	}
-
-	static std::optional<FB::TweenCurve> ParseTweenCurve(std::string s)
-	{
-		TrimInPlace(s);
-		s = ToLower(std::move(s));
-		if (s.empty() || s == "linear") {
+		s = Trim(s);
+		if (s.empty() || CaseFoldEqual{}(s, "linear")) {
 			return FB::TweenCurve::kLinear;
 		}
 		return std::nullopt;
 	}
 
-	static bool ParseBool(const std::string& v, bool fallback)
+	static bool ParseBool(std::string_view v, bool fallback)
 	{
-		std::string s = v;
-		TrimInPlace(s);
+		const auto s = Trim(v);
 		if (s.empty()) {
 			return fallback;
 		}
-		if (IEquals(s, "1") || IEquals(s, "true") || IEquals(s, "yes") || IEquals(s, "on")) {
+		if (CaseFoldEqual{}(s, "1") || CaseFoldEqual{}(s, "true") || CaseFoldEqual{}(s, "yes") || CaseFoldEqual{}(s, "on")) {
 			return true;
 		}
-		if (IEquals(s, "0") || IEquals(s, "false") || IEquals(s, "no") || IEquals(s, "off")) {
+		if (CaseFoldEqual{}(s, "0") || CaseFoldEqual{}(s, "false") || CaseFoldEqual{}(s, "no") || CaseFoldEqual{}(s, "off")) {
 			return false;
 		}
 		return fallback;
 	}
 
-	static std::vector<std::string> Split(const std::string& s, char delim)
+	static std::uint32_t ParseUInt(std::string_view v, std::uint32_t fallback)
 	{
-		std::vector<std::string> out;
-		std::string cur;
-		for (char c : s) {
-			if (c == delim) {
-				out.push_back(cur);
-				cur.clear();
-			}
-			else {
-				cur.push_back(c);
+		const auto s = Trim(v);
+
+		std::uint32_t out = 0;
+		const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+		return (ec == std::errc() && ptr == s.data() + s.size()) ? out : fallback;
+	}
+
+	static std::vector<std::string_view> Split(std::string_view s, char delim)
+	{
+		std::vector<std::string_view> out;
+		for (;;) {
+			const auto p = s.find(delim);
+			out.push_back(s.substr(0, p));
+			if (p == std::string_view::npos) {
+				return out;
 			}
+			s.remove_prefix(p + 1);
 		}
-		out.push_back(cur);
-		return out;
+	}
+
+	// Next whitespace-separated word of s (advancing s past it); empty at the end.
+	static std::string_view NextWord(std::string_view& s)
+	{
+		s = Trim(s);
+		std::size_t n = 0;
+		while (n < s.size() && !IsSpace(static_cast<unsigned char>(s[n]))) {
+			++n;
+		}
+		const auto word = s.substr(0, n);
+		s.remove_prefix(n);
+		return word;
+	}
+
+	// Next line of rest (without its terminator), advancing rest; false at the end of the buffer.
+	static bool NextLine(std::string_view& rest, std::string_view& line)
+	{
+		if (rest.empty()) {
+			return false;
+		}
+		const auto nl = rest.find('\n');
+		line = rest.substr(0, nl);
+		rest.remove_prefix(nl == std::string_view::npos ? rest.size() : nl + 1);
+		return true;
+	}
+
+	// Slurp a file in one read; the parser then works on views into this buffer.
+	static bool ReadWholeFile(const std::filesystem::path& path, std::string& out)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in.good()) {
+			return false;
+		}
+
+		const auto size = static_cast<std::streamoff>(in.tellg());
+		if (size < 0) {
+			return false;
+		}
+
+		out.resize(static_cast<std::size_t>(size));
+		in.seekg(0);
+		in.read(out.data(), size);
+		if (!in) {
+			return false;
+		}
+
+		// UTF-8 BOM (Notepad)
+		if (out.starts_with("\xEF\xBB\xBF")) {
+			out.erase(0, 3);
+		}
+		return true;
 	}
 
 	static std::filesystem::path GetConfigPathPreferred()
@@ -140,6 +189,56 @@ namespace
 		return std::filesystem::path("Data") / "SKSE" / "Plugins" / "FullBodiedIni.ini";
 	}
 
+	// Timeline packs: every *.ini here contributes [EventToTimeline] and [FB:...] sections.
+	static std::filesystem::path GetPackDirectory()
+	{
+		return std::filesystem::path("Data") / "SKSE" / "Plugins" / "FullBodied";
+	}
+
+	// Pack files sorted by file name (case-insensitive): the merge order, so results don't depend on
+	// directory enumeration order.
+	static std::vector<std::filesystem::path> FindPackFiles()
+	{
+		std::vector<std::filesystem::path> out;
+
+		std::error_code ec;
+		for (std::filesystem::directory_iterator it(GetPackDirectory(), ec), end; !ec && it != end; it.increment(ec)) {
+			const auto& path = it->path();
+			if (it->is_regular_file(ec) && CaseFoldEqual{}(path.extension().string(), ".ini")) {
+				out.push_back(path);
+			}
+		}
+
+		std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+			const auto an = a.filename().string();
+			const auto bn = b.filename().string();
+			return std::lexicographical_compare(an.begin(), an.end(), bn.begin(), bn.end(), [](char x, char y) {
+				return std::tolower(static_cast<unsigned char>(x)) < std::tolower(static_cast<unsigned char>(y));
+			});
+		});
+		return out;
+	}
+
+	// Run fn(i) for every i in [0, count) on up to hardware_concurrency threads (the caller is one of them).
+	template <class Fn>
+	static void ParallelFor(std::size_t count, Fn&& fn)
+	{
+		std::atomic<std::size_t> next{ 0 };
+		auto worker = [&]() {
+			for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+				fn(i);
+			}
+		};
+
+		const std::size_t threads = std::min<std::size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+		std::vector<std::jthread> pool;
+		pool.reserve(threads > 0 ? threads - 1 : 0);
+		for (std::size_t t = 1; t < threads; ++t) {
+			pool.emplace_back(worker);
+		}
+		worker();
+	}
+
 	// -------------------------
 	// FB section header: [FB:<timeline>|Caster/Target]
 	// -------------------------
@@ -150,14 +249,13 @@ namespace
 		bool supported{ false };
 	};
 
-	static std::optional<FBSection> ParseFBSectionName(const std::string& section, bool strictIni)
+	static std::optional<FBSection> ParseFBSectionName(std::string_view section, bool strictIni)
 	{
-		if (section.rfind("FB:", 0) != 0) {
+		if (!section.starts_with("FB:")) {
 			return std::nullopt;
 		}
 
-		const std::string rest = section.substr(3);
-		auto parts = Split(rest, '|');
+		const auto parts = Split(section.substr(3), '|');
 		if (parts.size() != 2) {
 			if (strictIni) {
 				spdlog::warn("[FB] INI: FB section expects 2 parts: '[FB:<timeline>|Caster/Target]' got '[{}]'", section);
@@ -166,16 +264,14 @@ namespace
 		}
 
 		FBSection out;
-		out.timeline = parts[0];
-		TrimInPlace(out.timeline);
+		out.timeline = Trim(parts[0]);
 
-		std::string who = parts[1];
-		TrimInPlace(who);
+		const auto who = Trim(parts[1]);
 
-		if (IEquals(who, "Caster")) {
+		if (CaseFoldEqual{}(who, "Caster")) {
 			out.who = FB::TargetKind::kCaster;
 		}
-		else if (IEquals(who, "Target")) {
+		else if (CaseFoldEqual{}(who, "Target")) {
 			out.who = FB::TargetKind::kTarget;
 		}
 		else {
@@ -194,8 +290,11 @@ namespace
 	// -------------------------
 	struct ParsedScale
 	{
-		std::string_view nodeName{};
+		FB::Scaler::NodeId node{ FB::Scaler::NodeId::kHead };
 		float scale{ 1.0f };
+
+		// Optional: > 0 => tween from the node's current scale over this many seconds
+		float tweenSeconds{ 0.0f };
 	};
 
 	struct ParsedHide
@@ -226,18 +325,15 @@ namespace
 		}
 
 		// Extract contents inside parentheses: FBHide( ... )
-		const auto innerView = token.substr(7, token.size() - 8);  // len("FBHide(")=7
-
-		// IEquals takes std::string, so convert once
-		const std::string inner{ innerView };
+		const auto inner = token.substr(7, token.size() - 8);  // len("FBHide(")=7
 
 		ParsedHide out{};
 
-		if (IEquals(inner, "true") || inner == "1") {
+		if (CaseFoldEqual{}(inner, "true") || inner == "1") {
 			out.hide = true;
 			return out;
 		}
-		if (IEquals(inner, "false") || inner == "0") {
+		if (CaseFoldEqual{}(inner, "false") || inner == "0") {
 			out.hide = false;
 			return out;
 		}
@@ -335,18 +431,17 @@ namespace
 		}
 
 		// Parse bool (same rules as v1)
-		const std::string rightStr{ right };  // IEquals takes std::string
 		bool hideValue = false;
 
-		if (IEquals(rightStr, "true") || rightStr == "1") {
+		if (CaseFoldEqual{}(right, "true") || right == "1") {
 			hideValue = true;
 		}
-		else if (IEquals(rightStr, "false") || rightStr == "0") {
+		else if (CaseFoldEqual{}(right, "false") || right == "0") {
 			hideValue = false;
 		}
 		else {
 			if (strictIni) {
-				spdlog::warn("[FB] INI: invalid FBHideSlot bool '{}'", rightStr);
+				spdlog::warn("[FB] INI: invalid FBHideSlot bool '{}'", right);
 			}
 			return std::nullopt;
 		}
@@ -394,16 +489,29 @@ namespace
 			return std::nullopt;
 		}
 
-		auto nodeName = resolver(nodeKey);
-		if (!nodeName) {
+		auto node = resolver(nodeKey);
+		if (!node) {
 			if (strictIni) {
 				spdlog::warn("[FB] INI: unknown NodeKey '{}' in '{}'", std::string(nodeKey), std::string(tok));
 			}
 			return std::nullopt;
 		}
 
-		std::string arg{ tok.substr(open + 1, close - open - 1) };
-		TrimInPlace(arg);
+		// Args can be:
+		//   (scale)
+		//   (scale, seconds)
+		//   (scale, tween=seconds)
+		const auto args = Trim(tok.substr(open + 1, close - open - 1));
+
+		const auto parts = Split(args, ',');
+		if (parts.empty() || parts.size() > 2) {
+			if (strictIni) {
+				spdlog::warn("[FB] INI: FBScale expects (scale) or (scale, seconds) in '{}'", std::string(tok));
+			}
+			return std::nullopt;
+		}
+
+		const auto arg = Trim(parts[0]);
 
 		auto f = ParseFloat(arg);
 		if (!f) {
@@ -414,8 +522,33 @@ namespace
 		}
 
 		ParsedScale out;
-		out.nodeName = *nodeName;
+		out.node = *node;
 		out.scale = *f;
+
+		if (parts.size() == 2) {
+			auto secs = Trim(parts[1]);
+
+			if (const auto eq = secs.find('='); eq != std::string_view::npos) {
+				const auto key = Trim(secs.substr(0, eq));
+				if (!CaseFoldEqual{}(key, "tween") && !CaseFoldEqual{}(key, "tweenseconds") && !CaseFoldEqual{}(key, "duration") && !CaseFoldEqual{}(key, "dur")) {
+					if (strictIni) {
+						spdlog::warn("[FB] INI: FBScale unknown field '{}' in '{}'", key, std::string(tok));
+					}
+					return std::nullopt;
+				}
+				secs = Trim(secs.substr(eq + 1));
+			}
+
+			auto tf = ParseFloat(secs);
+			if (!tf || *tf < 0.0f) {
+				if (strictIni) {
+					spdlog::warn("[FB] INI: FBScale invalid tween seconds '{}' in '{}'", secs, std::string(tok));
+				}
+				return std::nullopt;
+			}
+			out.tweenSeconds = *tf;
+		}
+
 		return out;
 	}
 
@@ -482,10 +615,9 @@ namespace
 		// Args can be:
 		//   (delta)
 		//   (delta, tween=0.5, curve=linear)
-		std::string args{ tok.substr(open + 1, close - open - 1) };
-		TrimInPlace(args);
+		const auto args = Trim(tok.substr(open + 1, close - open - 1));
 
-		auto parts = Split(args, ',');
+		const auto parts = Split(args, ',');
 		if (parts.empty()) {
 			if (strictIni) {
 				spdlog::warn("[FB] INI: FBMorph missing args in '{}'", std::string(tok));
@@ -494,8 +626,7 @@ namespace
 		}
 
 		// First arg is always delta
-		std::string deltaStr = parts[0];
-		TrimInPlace(deltaStr);
+		const auto deltaStr = Trim(parts[0]);
 		auto f = ParseFloat(deltaStr);
 		if (!f) {
 			if (strictIni) {
@@ -510,14 +641,13 @@ namespace
 
 		// Optional key=value fields
 		for (size_t i = 1; i < parts.size(); ++i) {
-			std::string kv = parts[i];
-			TrimInPlace(kv);
+			const auto kv = Trim(parts[i]);
 			if (kv.empty()) {
 				continue;
 			}
 
 			const auto eq = kv.find('=');
-			if (eq == std::string::npos) {
+			if (eq == std::string_view::npos) {
 				if (strictIni) {
 					spdlog::warn("[FB] INI: FBMorph tween field missing '=' in '{}' (token '{}')", kv, std::string(tok));
 					return std::nullopt;
@@ -526,13 +656,10 @@ namespace
 				continue;
 			}
 
-			std::string key = kv.substr(0, eq);
-			std::string val = kv.substr(eq + 1);
-			TrimInPlace(key);
-			TrimInPlace(val);
-			key = ToLower(std::move(key));
+			const auto key = Trim(kv.substr(0, eq));
+			const auto val = Trim(kv.substr(eq + 1));
 
-			if (key == "tween" || key == "tweenseconds" || key == "duration" || key == "dur") {
+			if (CaseFoldEqual{}(key, "tween") || CaseFoldEqual{}(key, "tweenseconds") || CaseFoldEqual{}(key, "duration") || CaseFoldEqual{}(key, "dur")) {
 				auto tf = ParseFloat(val);
 				if (!tf || *tf < 0.0f) {
 					if (strictIni) {
@@ -544,7 +671,7 @@ namespace
 				}
 				out.tweenSeconds = *tf;
 			}
-			else if (key == "curve") {
+			else if (CaseFoldEqual{}(key, "curve")) {
 				auto curve = ParseTweenCurve(val);
 				if (!curve) {
 					if (strictIni) {
@@ -601,9 +728,8 @@ namespace
 
 		auto parse_bool = [&](std::string_view s) -> std::optional<bool> {
 			s = trim_sv(s);
-			const std::string ss{ s };
-			if (IEquals(ss, "true") || s == "1")  return true;
-			if (IEquals(ss, "false") || s == "0") return false;
+			if (CaseFoldEqual{}(s, "true") || s == "1")  return true;
+			if (CaseFoldEqual{}(s, "false") || s == "0") return false;
 			return std::nullopt;
 			};
 
@@ -706,7 +832,7 @@ namespace
 
 	static std::optional<FB::TimedCommand> ParseCommand(
 		float t,
-		const std::string& cmdTok,
+		std::string_view cmdTok,
 		FB::TargetKind who,
 		bool strictIni,
 		bool logIni,
@@ -722,8 +848,9 @@ namespace
 				c.timeSeconds = t;
 				c.kind = FB::CommandKind::kScale;
 				c.target = dest;
-				c.nodeKey = s->nodeName;
+				c.node = s->node;
 				c.scale = s->scale;
+				c.tweenSeconds = s->tweenSeconds;
 				return c;
 			}
 
@@ -733,7 +860,10 @@ namespace
 				c.timeSeconds = t;
 				c.kind = FB::CommandKind::kMorph;
 				c.target = dest;
-				c.morphName = m->morphName;  // OWNED std::string
+				c.morph = FB::Morph::InternMorph(m->morphName);
+				if (c.morph == FB::Morph::kInvalidMorphId) {
+					return std::nullopt;
+				}
 				c.delta = m->delta;
 				c.tweenSeconds = m->tweenSeconds;
 				c.tweenCurve = m->tweenCurve;
@@ -764,14 +894,14 @@ namespace
 
 		if (who == FB::TargetKind::kTarget) {
 			// Target section REQUIRES "2_" prefix
-			if (cmdTok.rfind(std::string(kTargetPrefix), 0) != 0) {
+			if (!cmdTok.starts_with(kTargetPrefix)) {
 				if (strictIni) {
 					spdlog::warn("[FB] INI: Target section requires '2_' prefix, got '{}'", cmdTok);
 				}
 				return std::nullopt;
 			}
 
-			std::string_view inner{ cmdTok.c_str() + kTargetPrefix.size(), cmdTok.size() - kTargetPrefix.size() };
+			const auto inner = cmdTok.substr(kTargetPrefix.size());
 
 			if (auto cmd = parse_inner(inner, FB::TargetKind::kTarget)) {
 				return cmd;
@@ -784,7 +914,7 @@ namespace
 		}
 
 		// Caster section must NOT use "2_"
-		if (cmdTok.rfind(std::string(kTargetPrefix), 0) == 0) {
+		if (cmdTok.starts_with(kTargetPrefix)) {
 			if (strictIni) {
 				spdlog::warn("[FB] INI: Caster section must NOT use '2_' prefix, got '{}'", cmdTok);
 			}
@@ -817,244 +947,809 @@ namespace
 			}
 		}
 
-		std::sort(cmds.begin(), cmds.end(),
+		// Stable: commands sharing a time run in the order they were authored.
+		std::stable_sort(cmds.begin(), cmds.end(),
 			[](const auto& a, const auto& b) { return a.timeSeconds < b.timeSeconds; });
 	}
 
+	// Timeline compiler: split sorted commands into the per-kind payload arrays the runtime consumes,
+	// plus the time-ordered dispatch stream referencing them.
+	static FB::TimelinePtr CompileTimeline(const std::vector<FB::TimedCommand>& cmds)
+	{
+		auto out = std::make_shared<FB::CompiledTimeline>();
+		out->order.reserve(cmds.size());
+
+		for (const auto& c : cmds) {
+			std::size_t index = 0;
+			switch (c.kind) {
+			case FB::CommandKind::kScale:
+				index = out->scales.size();
+				out->scales.push_back({ c.timeSeconds, c.node, c.target, c.scale, c.tweenSeconds });
+				break;
+			case FB::CommandKind::kMorph:
+				index = out->morphs.size();
+				out->morphs.push_back({ c.timeSeconds, c.target, c.tweenCurve, c.morph, c.delta, c.tweenSeconds });
+				break;
+			case FB::CommandKind::kHide:
+				index = out->hides.size();
+				out->hides.push_back({ c.timeSeconds, c.target, c.hideMode, c.hideSlot, c.hide });
+				break;
+			case FB::CommandKind::kCount:
+				continue;
+			}
+
+			out->order.push_back({ c.timeSeconds, c.kind, static_cast<std::uint32_t>(index) });
+		}
+
+		out->scales.shrink_to_fit();
+		out->morphs.shrink_to_fit();
+		out->hides.shrink_to_fit();
+		return out;
+	}
+
 	// -------------------------
 	// FBConfig cache
 	// -------------------------
-	std::mutex g_cfgMutex;
-	FB::Config::ConfigData g_cfg;
-	bool g_loaded = false;
-	FB::Config::NodeKeyResolver g_resolver = nullptr;
-
-	static void LoadConfigLocked()
+	// Writers (first load, Reload, hot-reload watcher) serialize on g_loadMutex and publish a
+	// complete immutable snapshot. Readers never block on the loader/parse mutex, only on g_cfg's
+	// own short internal lock (std::atomic<std::shared_ptr> is not lock-free); a snapshot they hold
+	// stays valid for as long as they keep the shared_ptr, even across a reload.
+	std::mutex g_loadMutex;
+	std::atomic<FB::Config::ConfigPtr> g_cfg;
+	std::atomic<FB::Config::NodeKeyResolver> g_resolver{ nullptr };
+
+	// Hot reload: poll the loaded INI's write time from a background thread.
+	constexpr auto kHotReloadPollInterval = std::chrono::seconds(1);
+	std::jthread g_watcher;
+
+	// Lazy-mode warm-up (WarmTimelinesAsync); replacing g_warmer stops and joins the previous run.
+	std::atomic<bool> g_warmRequested{ false };
+	std::jthread g_warmer;
+
+	static void BuildEventFilter(FB::Config::ConfigData& cfg)
 	{
-		FB::Config::ConfigData newCfg;
+		auto& filter = cfg.startEvents;
 
-		auto path = GetConfigPathPreferred();
-		std::ifstream in(path);
+		if (!cfg.enableTimelines) {
+			return;
+		}
 
-		if (!in.good()) {
-			auto fb = GetConfigPathFallback();
-			in.open(fb);
-			if (in.good()) {
-				path = fb;
-				spdlog::info("[FB] Using fallback config path: {}", path.string());
+		for (const auto& [tag, timeline] : cfg.eventToTimeline) {
+			FB::Config::StartEvent start{ .timeline = timeline };
+
+			if (const auto it = cfg.timelines.find(timeline); it != cfg.timelines.end() && it->second && !it->second->Empty()) {
+				start.commands = it->second;
 			}
+			else if (const auto lazy = cfg.lazyTimelines.find(timeline); lazy != cfg.lazyTimelines.end()) {
+				start.lazy = lazy->second;  // emptiness is only known once compiled
+			}
+			else {
+				if (cfg.dbg.logIni) {
+					spdlog::info("[FB] INI: event '{}' maps to timeline '{}' which has no commands", tag, timeline);
+				}
+				continue;
+			}
+
+			// eventToTimeline is keyed case-insensitively too: one entry per tag, nothing to resolve here
+			filter.startEvents.emplace(tag, std::move(start));
 		}
+	}
 
-		if (!in.good()) {
-			spdlog::warn("[FB] Config not found: {} (and fallback missing: {}) - using defaults",
-				GetConfigPathPreferred().string(),
-				GetConfigPathFallback().string());
-			g_cfg = std::move(newCfg);
-			g_loaded = true;
+	// One key = value line of [General] / [Debug] / [EventToTimeline] (already comment-stripped and trimmed).
+	static void ParseSettingLine(std::string_view currentSection, std::string_view line, FB::Config::ConfigData& cfg)
+	{
+		const auto eq = line.find('=');
+		if (eq == std::string_view::npos) {
 			return;
 		}
 
-		spdlog::info("[FB] Config path: {}", path.string());
+		const auto key = Trim(line.substr(0, eq));
+		const auto val = Trim(line.substr(eq + 1));
 
-		// Read whole file for 2-pass parse
-		std::vector<std::string> lines;
-		{
-			std::string line;
-			while (std::getline(in, line)) {
-				lines.push_back(std::move(line));
+		// [General]
+		if (CaseFoldEqual{}(currentSection, "General")) {
+			if (CaseFoldEqual{}(key, "enableTimelines") ||
+				//CaseFoldEqual{}(key, "bEnableHeadScaleTimelines") ||
+				CaseFoldEqual{}(key, "bEnableTimelines")) {
+				cfg.enableTimelines = ParseBool(val, cfg.enableTimelines);
+			}
+			else if (CaseFoldEqual{}(key, "resetOnPairEnd")) {
+				cfg.resetOnPairEnd = ParseBool(val, cfg.resetOnPairEnd);
+			}
+			else if (CaseFoldEqual{}(key, "resetOnPairedStop")) {
+				cfg.resetOnPairedStop = ParseBool(val, cfg.resetOnPairedStop);
+			}
+			else if (CaseFoldEqual{}(key, "resetMorphsOnPairEnd")) {
+				cfg.resetMorphsOnPairEnd = ParseBool(val, cfg.resetMorphsOnPairEnd);
+			}
+			else if (CaseFoldEqual{}(key, "resetMorphsOnPairedStop")) {
+				cfg.resetMorphsOnPairedStop = ParseBool(val, cfg.resetMorphsOnPairedStop);
+			}
+			else if (CaseFoldEqual{}(key, "nativeMorphs")) {
+				cfg.nativeMorphs = ParseBool(val, cfg.nativeMorphs);
+			}
+			else if (CaseFoldEqual{}(key, "lazyTimelines")) {
+				cfg.lazyCompile = ParseBool(val, cfg.lazyCompile);
+			}
+			else if (CaseFoldEqual{}(key, "warmTimelines")) {
+				cfg.warmTimelines = ParseBool(val, cfg.warmTimelines);
 			}
+			else if (CaseFoldEqual{}(key, "syncToClipTime")) {
+				cfg.syncToClipTime = ParseBool(val, cfg.syncToClipTime);
+			}
+			else if (CaseFoldEqual{}(key, "frameBudgetMicros")) {
+				cfg.frameBudgetMicros = ParseUInt(val, cfg.frameBudgetMicros);
+			}
+			else if (CaseFoldEqual{}(key, "lodFarDistance")) {
+				cfg.lod.farDistance = std::max(0.0f, ParseFloat(val).value_or(cfg.lod.farDistance));
+			}
+			else if (CaseFoldEqual{}(key, "lodFarUpdateHz")) {
+				cfg.lod.farUpdateHz = std::max(0.0f, ParseFloat(val).value_or(cfg.lod.farUpdateHz));
+			}
+			else if (CaseFoldEqual{}(key, "lodCullDistance")) {
+				cfg.lod.cullDistance = std::max(0.0f, ParseFloat(val).value_or(cfg.lod.cullDistance));
+			}
+			return;
 		}
 
-		auto parse_non_fb_sections = [&](const std::string& currentSection, const std::string& rawLine) {
-			std::string line = rawLine;
-			StripInlineComment(line);
-			TrimInPlace(line);
-			if (line.empty()) {
-				return;
+		// [Debug]
+		if (CaseFoldEqual{}(currentSection, "Debug")) {
+			if (CaseFoldEqual{}(key, "bStrictIni")) {
+				cfg.dbg.strictIni = ParseBool(val, cfg.dbg.strictIni);
+			}
+			else if (CaseFoldEqual{}(key, "bLogTimelineStart")) {
+				cfg.dbg.logTimelineStart = ParseBool(val, cfg.dbg.logTimelineStart);
+			}
+			else if (CaseFoldEqual{}(key, "bLogTargetResolve")) {
+				cfg.dbg.logTargetResolve = ParseBool(val, cfg.dbg.logTargetResolve);
+			}
+			else if (CaseFoldEqual{}(key, "bLogOps") || CaseFoldEqual{}(key, "bLogHeadScale")) {
+				cfg.dbg.logOps = ParseBool(val, cfg.dbg.logOps);
 			}
+			else if (CaseFoldEqual{}(key, "bLogIni")) {
+				cfg.dbg.logIni = ParseBool(val, cfg.dbg.logIni);
+			}
+			else if (CaseFoldEqual{}(key, "bHotReload")) {
+				cfg.dbg.hotReload = ParseBool(val, cfg.dbg.hotReload);
+			}
+			else if (CaseFoldEqual{}(key, "bAsyncLog")) {
+				cfg.dbg.log.async = ParseBool(val, cfg.dbg.log.async);
+			}
+			else if (CaseFoldEqual{}(key, "iLogQueueSize")) {
+				cfg.dbg.log.queueSize = std::max<std::uint32_t>(ParseUInt(val, static_cast<std::uint32_t>(cfg.dbg.log.queueSize)), 64);
+			}
+			else if (CaseFoldEqual{}(key, "iLogFlushSeconds")) {
+				cfg.dbg.log.flushSeconds = ParseUInt(val, cfg.dbg.log.flushSeconds);
+			}
+			else if (CaseFoldEqual{}(key, "iLogRateLimit")) {
+				cfg.dbg.log.rateLimitPerSecond = ParseUInt(val, cfg.dbg.log.rateLimitPerSecond);
+			}
+			else if (CaseFoldEqual{}(key, "iStatsLogSeconds")) {
+				cfg.dbg.statsLogSeconds = ParseUInt(val, cfg.dbg.statsLogSeconds);
+			}
+			else if (CaseFoldEqual{}(key, "bConfigCache")) {
+				cfg.dbg.configCache = ParseBool(val, cfg.dbg.configCache);
+			}
+			return;
+		}
 
-			auto eq = line.find('=');
-			if (eq == std::string::npos) {
-				return;
+		// [EventToTimeline] (also supports legacy [EventMap])
+		if (CaseFoldEqual{}(currentSection, "EventToTimeline") || CaseFoldEqual{}(currentSection, "EventMap")) {
+			if (!key.empty() && !val.empty()) {
+				// Last line wins, also over an earlier spelling of the same tag in another case
+				auto& timeline = cfg.eventToTimeline[std::string(key)];
+				if (!timeline.empty() && timeline != val && cfg.dbg.strictIni) {
+					spdlog::warn("[FB] INI: event '{}' maps to both '{}' and '{}' (case-insensitive); keeping the later '{}'",
+						key, timeline, val, val);
+				}
+				timeline = val;
 			}
+			return;
+		}
+	}
 
-			std::string key = line.substr(0, eq);
-			std::string val = line.substr(eq + 1);
-			TrimInPlace(key);
-			TrimInPlace(val);
+	// An [FB:...] section: its header and the byte range of its body in the file buffer. Headers are
+	// resolved once the whole file has been scanned (bStrictIni / bLogIni may be set further down
+	// than the timelines they affect).
+	struct TimelineSectionRange
+	{
+		std::string_view header;
+		std::size_t offset{ 0 };
+		std::size_t size{ 0 };
+	};
 
-			// [General]
-			if (IEquals(currentSection, "General")) {
-				if (IEquals(key, "enableTimelines") ||
-					//IEquals(key, "bEnableHeadScaleTimelines") ||
-					IEquals(key, "bEnableTimelines")) {
-					newCfg.enableTimelines = ParseBool(val, newCfg.enableTimelines);
-				}
-				else if (IEquals(key, "resetOnPairEnd")) {
-					newCfg.resetOnPairEnd = ParseBool(val, newCfg.resetOnPairEnd);
-				}
-				else if (IEquals(key, "resetOnPairedStop")) {
-					newCfg.resetOnPairedStop = ParseBool(val, newCfg.resetOnPairedStop);
-				}
-				else if (IEquals(key, "resetMorphsOnPairEnd")) {
-					newCfg.resetMorphsOnPairEnd = ParseBool(val, newCfg.resetMorphsOnPairEnd);
-				}
-				else if (IEquals(key, "resetMorphsOnPairedStop")) {
-					newCfg.resetMorphsOnPairedStop = ParseBool(val, newCfg.resetMorphsOnPairedStop);
-				}
-				return;
+	// Parse the body of one [FB:...] section into cmds (eager load, or a lazy timeline's first use).
+	static void ParseTimelineSection(
+		std::string_view body,
+		std::string_view sectionName,
+		std::string_view timeline,
+		FB::TargetKind who,
+		bool strictIni,
+		bool logIni,
+		FB::Config::NodeKeyResolver resolver,
+		std::vector<FB::TimedCommand>& cmds)
+	{
+		std::string_view rest = body;
+		std::string_view raw;
+		while (NextLine(rest, raw)) {
+			const auto line = Trim(StripInlineComment(raw));
+			if (line.empty()) {
+				continue;
 			}
 
-			// [Debug]
-			if (IEquals(currentSection, "Debug")) {
-				if (IEquals(key, "bStrictIni")) {
-					newCfg.dbg.strictIni = ParseBool(val, newCfg.dbg.strictIni);
+			// IMPORTANT: command token must not contain spaces (e.g. "FBMorph_X(10)" is OK)
+			auto words = line;
+			const auto timeTok = NextWord(words);
+			const auto cmdTok = NextWord(words);
+			if (cmdTok.empty()) {
+				continue;
+			}
+
+			auto t = ParseFloat(timeTok);
+			if (!t) {
+				if (strictIni) {
+					spdlog::warn("[FB] INI: bad time token '{}' in section '{}'", timeTok, sectionName);
 				}
-				else if (IEquals(key, "bLogTimelineStart")) {
-					newCfg.dbg.logTimelineStart = ParseBool(val, newCfg.dbg.logTimelineStart);
+				continue;
+			}
+
+			if (auto cmd = ParseCommand(*t, cmdTok, who, strictIni, logIni, resolver)) {
+				cmds.push_back(*cmd);
+
+				// TODO(TweenRefactor): Phase 3 Step 5 - log tween parsing with timeline context
+				if (logIni &&
+					cmd->kind == FB::CommandKind::kMorph &&
+					cmd->tweenSeconds > 0.0f) {
+					spdlog::info(
+						"[FB] INI: tween parsed timeline='{}' who={} morph='{}' delta={} tweenSeconds={} curve=linear",
+						timeline,
+						(who == FB::TargetKind::kCaster ? "Caster" : "Target"),
+						FB::Morph::MorphName(cmd->morph),
+						cmd->delta,
+						cmd->tweenSeconds);
 				}
-				else if (IEquals(key, "bLogTargetResolve")) {
-					newCfg.dbg.logTargetResolve = ParseBool(val, newCfg.dbg.logTargetResolve);
+			}
+		}
+	}
+
+	// Single tokenizing pass over the file buffer. Settings are applied as they are met; [FB:...] bodies
+	// are only delimited, then compiled afterwards (or, with LazyTimelines, indexed for first use).
+	// fromCache skips them entirely (their compiled form came from the cache).
+	// Packs only contribute [EventToTimeline] and [FB:...].
+	static void ParseIni(
+		const std::shared_ptr<const std::string>& source,
+		FB::Config::ConfigData& cfg,
+		FB::Config::NodeKeyResolver resolver,
+		bool fromCache,
+		bool isPack)
+	{
+		const std::string_view text = *source;
+		std::vector<TimelineSectionRange> fbSections;
+
+		std::string_view currentSection;
+		bool inFBSection = false;
+		bool skipSection = false;
+
+		std::string_view rest = text;
+		std::string_view raw;
+		while (NextLine(rest, raw)) {
+			const auto line = Trim(StripInlineComment(raw));
+			if (line.empty()) {
+				continue;
+			}
+
+			if (line.size() >= 3 && line.front() == '[' && line.back() == ']') {
+				if (inFBSection) {
+					auto& open = fbSections.back();
+					open.size = static_cast<std::size_t>(raw.data() - text.data()) - open.offset;
 				}
-				else if (IEquals(key, "bLogOps") || IEquals(key, "bLogHeadScale")) {
-					newCfg.dbg.logOps = ParseBool(val, newCfg.dbg.logOps);
+
+				currentSection = Trim(line.substr(1, line.size() - 2));
+				inFBSection = currentSection.starts_with("FB:");
+				if (inFBSection) {
+					fbSections.push_back({ currentSection, static_cast<std::size_t>(rest.data() - text.data()), 0 });
 				}
-				else if (IEquals(key, "bLogIni")) {
-					newCfg.dbg.logIni = ParseBool(val, newCfg.dbg.logIni);
+
+				skipSection = isPack && !inFBSection &&
+					!CaseFoldEqual{}(currentSection, "EventToTimeline") && !CaseFoldEqual{}(currentSection, "EventMap");
+				if (skipSection && cfg.dbg.strictIni) {
+					spdlog::warn("[FB] Packs: section '[{}]' is only read from the main INI; ignored", currentSection);
 				}
-				return;
+				continue;
 			}
 
-			// [EventToTimeline] (also supports legacy [EventMap])
-			if (IEquals(currentSection, "EventToTimeline") || IEquals(currentSection, "EventMap")) {
-				if (!key.empty() && !val.empty()) {
-					newCfg.eventToTimeline[key] = val;
-				}
-				return;
+			if (inFBSection || skipSection) {
+				continue;
 			}
-			};
 
-		// Pass 1
-		{
-			std::string currentSection;
+			ParseSettingLine(currentSection, line, cfg);
+		}
+
+		if (inFBSection) {
+			auto& open = fbSections.back();
+			open.size = text.size() - open.offset;
+		}
 
-			for (const auto& raw : lines) {
-				std::string line = raw;
-				StripInlineComment(line);
-				TrimInPlace(line);
-				if (line.empty()) {
+		if (fromCache) {
+			return;
+		}
+
+		const bool strictIni = cfg.dbg.strictIni;
+		const bool logIni = cfg.dbg.logIni;
+
+		// Resolve each FB section header once; unsupported sections are dropped.
+		if (cfg.lazyCompile) {
+			std::unordered_map<std::string, std::shared_ptr<FB::Config::LazyTimeline>> lazyTimelines;
+			for (const auto& section : fbSections) {
+				const auto header = ParseFBSectionName(section.header, strictIni);
+				if (!header || !header->supported || header->timeline.empty()) {
 					continue;
 				}
 
-				if (line.size() >= 3 && line.front() == '[' && line.back() == ']') {
-					currentSection = line.substr(1, line.size() - 2);
-					TrimInPlace(currentSection);
-					continue;
+				auto& lazy = lazyTimelines[header->timeline];
+				if (!lazy) {
+					lazy = std::make_shared<FB::Config::LazyTimeline>(header->timeline, source, resolver, strictIni, logIni);
 				}
+				lazy->AddSection({ std::string(section.header), header->who, section.offset, section.size });
+			}
+
+			for (auto& [name, lazy] : lazyTimelines) {
+				cfg.lazyTimelines.emplace(name, std::move(lazy));
+			}
+			return;
+		}
 
-				parse_non_fb_sections(currentSection, raw);
+		std::unordered_map<std::string, std::vector<FB::TimedCommand>> parsedTimelines;
+		for (const auto& section : fbSections) {
+			const auto header = ParseFBSectionName(section.header, strictIni);
+			if (!header || !header->supported || header->timeline.empty()) {
+				continue;
 			}
+
+			ParseTimelineSection(text.substr(section.offset, section.size), section.header, header->timeline, header->who,
+				strictIni, logIni, resolver, parsedTimelines[header->timeline]);
 		}
 
-		// Pass 2: FB sections
-		{
-			std::string currentSection;
-			std::optional<FBSection> activeFBSection;
-
-			for (const auto& raw : lines) {
-				std::string line = raw;
-				StripInlineComment(line);
-				TrimInPlace(line);
-				if (line.empty()) {
-					continue;
-				}
+		for (auto& [name, cmds] : parsedTimelines) {
+			SortAndClamp(cmds);
+			cfg.timelines.emplace(name, CompileTimeline(cmds));
+		}
+	}
 
-				if (line.size() >= 3 && line.front() == '[' && line.back() == ']') {
-					currentSection = line.substr(1, line.size() - 2);
-					TrimInPlace(currentSection);
-					activeFBSection = ParseFBSectionName(currentSection, newCfg.dbg.strictIni);
-					continue;
-				}
+	// Parse one file into cfg, reusing its .fbcache when the file is unchanged. Returns true on a cache hit.
+	static bool ParseSourceFile(
+		const std::filesystem::path& path,
+		const std::shared_ptr<const std::string>& source,
+		FB::Config::ConfigData& cfg,
+		FB::Config::NodeKeyResolver resolver,
+		bool isPack)
+	{
+		// An unchanged file (same size, mtime and content hash) reuses the compiled timelines from the
+		// last load that wrote the cache; only the settings sections are scanned.
+		const auto cacheKey = FB::Config::Cache::MakeKey(path, *source);
+		const auto cachePath = FB::Config::Cache::PathFor(path);
 
-				if (activeFBSection && activeFBSection->supported && !activeFBSection->timeline.empty()) {
-					std::istringstream iss(line);
-					std::string timeTok;
-					std::string cmdTok;
+		FB::Config::Cache::Payload cached;
+		const bool cacheHit = FB::Config::Cache::Load(cachePath, cacheKey, cached);
 
-					// IMPORTANT: command token must not contain spaces (e.g. "FBMorph_X(10)" is OK)
-					if (!(iss >> timeTok >> cmdTok)) {
-						continue;
-					}
+		ParseIni(source, cfg, resolver, cacheHit, isPack);
 
-					auto t = ParseFloat(timeTok);
-					if (!t) {
-						if (newCfg.dbg.strictIni) {
-							spdlog::warn("[FB] INI: bad time token '{}' in section '{}'", timeTok, currentSection);
-						}
-						continue;
-					}
+		if (cacheHit) {
+			cfg.timelines = std::move(cached.timelines);
+			if (cfg.dbg.logIni) {
+				spdlog::info("[FB] Config cache: using '{}' ({} timelines)", cachePath.string(), cfg.timelines.size());
+			}
+		}
+		else if (cfg.dbg.configCache && resolver && !cfg.lazyCompile) {
+			// (Lazy mode compiled nothing to store; an existing cache is still used while it is valid.)
+			FB::Config::Cache::Payload payload;
+			payload.timelines = cfg.timelines;  // shared pointers; the compiled data is not copied
+			if (FB::Config::Cache::Store(cachePath, cacheKey, payload) && cfg.dbg.logIni) {
+				spdlog::info("[FB] Config cache: wrote '{}'", cachePath.string());
+			}
+		}
 
-					if (auto cmd = ParseCommand(*t, cmdTok, activeFBSection->who, newCfg.dbg.strictIni, newCfg.dbg.logIni, g_resolver)) {
-						newCfg.timelines[activeFBSection->timeline].push_back(*cmd);
-
-						// TODO(TweenRefactor): Phase 3 Step 5 - log tween parsing with timeline context
-						if (newCfg.dbg.logIni &&
-							cmd->kind == FB::CommandKind::kMorph &&
-							cmd->tweenSeconds > 0.0f) {
-							spdlog::info(
-								"[FB] INI: tween parsed timeline='{}' who={} morph='{}' delta={} tweenSeconds={} curve=linear",
-								activeFBSection->timeline,
-								(activeFBSection->who == FB::TargetKind::kCaster ? "Caster" : "Target"),
-								cmd->morphName,
-								cmd->delta,
-								cmd->tweenSeconds);
-						}
-					}
+		return cacheHit;
+	}
+
+	// Per-file results of a load, merged in order: later sources win, every override is reported.
+	struct MergeState
+	{
+		std::unordered_map<std::string, std::string, FB::Config::CaseFoldHash, FB::Config::CaseFoldEqual> eventOrigin;  // tag -> file
+		std::unordered_map<std::string, std::string> timelineOrigin;  // timeline -> file
+	};
 
+	static void MergeSource(FB::Config::ConfigData& into, FB::Config::ConfigData&& from, const std::string& origin, MergeState& state)
+	{
+		// Sorted so conflict warnings come out in the same order on every load. Tags compare
+		// case-insensitively, so a pack that only re-cases a tag still overrides (and is reported).
+		std::vector<std::string> tags;
+		tags.reserve(from.eventToTimeline.size());
+		for (const auto& [tag, timeline] : from.eventToTimeline) {
+			tags.push_back(tag);
+		}
+		std::sort(tags.begin(), tags.end());
+
+		for (const auto& tag : tags) {
+			auto& timeline = from.eventToTimeline[tag];
+			auto [it, inserted] = state.eventOrigin.try_emplace(tag, origin);
+			if (!inserted) {
+				if (into.eventToTimeline[tag] != timeline) {
+					spdlog::warn("[FB] Packs: event '{}' -> '{}' from '{}' overrides -> '{}' from '{}'",
+						tag, timeline, origin, into.eventToTimeline[tag], it->second);
 				}
+				it->second = origin;
 			}
+			into.eventToTimeline[tag] = std::move(timeline);
 		}
 
-		for (auto& [name, cmds] : newCfg.timelines) {
-			SortAndClamp(cmds);
+		std::vector<std::string> names;
+		names.reserve(from.timelines.size() + from.lazyTimelines.size());
+		for (const auto& [name, timeline] : from.timelines) {
+			names.push_back(name);
+		}
+		for (const auto& [name, timeline] : from.lazyTimelines) {
+			names.push_back(name);
+		}
+		std::sort(names.begin(), names.end());
+
+		for (const auto& name : names) {
+			auto [it, inserted] = state.timelineOrigin.try_emplace(name, origin);
+			if (!inserted) {
+				spdlog::warn("[FB] Packs: timeline '{}' from '{}' replaces the one from '{}'", name, origin, it->second);
+				it->second = origin;
+			}
+
+			// A source's timelines are either all cached-compiled or all lazy; the replaced one may be either.
+			into.timelines.erase(name);
+			into.lazyTimelines.erase(name);
+			if (const auto tl = from.timelines.find(name); tl != from.timelines.end()) {
+				into.timelines.emplace(name, std::move(tl->second));
+			}
+			else {
+				into.lazyTimelines.emplace(name, std::move(from.lazyTimelines[name]));
+			}
+		}
+	}
+
+	// Parse every pack concurrently (one file per task), then merge: packs by file name, the main INI last.
+	static void LoadPacks(FB::Config::ConfigData& newCfg, FB::Config::NodeKeyResolver resolver)
+	{
+		const auto files = FindPackFiles();
+		if (files.empty()) {
+			return;
+		}
+
+		struct PackResult
+		{
+			bool loaded{ false };
+			bool cacheHit{ false };
+			FB::Config::ConfigData data;
+			std::filesystem::file_time_type writeTime{};
+		};
+		std::vector<PackResult> results(files.size());
+
+		const auto start = std::chrono::steady_clock::now();
+
+		ParallelFor(files.size(), [&](std::size_t i) {
+			auto& r = results[i];
+			auto text = std::make_shared<std::string>();
+			if (!ReadWholeFile(files[i], *text)) {
+				spdlog::warn("[FB] Packs: could not read '{}'", files[i].string());
+				return;
+			}
+
+			// Packs parse under the main INI's debug flags (bStrictIni / bLogIni / bConfigCache) and LazyTimelines
+			r.data.dbg = newCfg.dbg;
+			r.data.lazyCompile = newCfg.lazyCompile;
+			r.cacheHit = ParseSourceFile(files[i], text, r.data, resolver, true);
+			r.loaded = true;
+
+			std::error_code ec;
+			r.writeTime = std::filesystem::last_write_time(files[i], ec);
+		});
+
+		const auto elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		// The main INI's own mappings/timelines take precedence over every pack.
+		FB::Config::ConfigData main;
+		main.eventToTimeline = std::move(newCfg.eventToTimeline);
+		main.timelines = std::move(newCfg.timelines);
+		main.lazyTimelines = std::move(newCfg.lazyTimelines);
+		newCfg.eventToTimeline.clear();
+		newCfg.timelines.clear();
+		newCfg.lazyTimelines.clear();
+
+		MergeState state;
+		std::size_t loaded = 0;
+		std::size_t cacheHits = 0;
+		for (std::size_t i = 0; i < files.size(); ++i) {
+			auto& r = results[i];
+			if (!r.loaded) {
+				continue;
+			}
+
+			++loaded;
+			cacheHits += r.cacheHit ? 1 : 0;
+			newCfg.packSources.push_back({ files[i], r.writeTime });
+
+			if (newCfg.dbg.logIni) {
+				spdlog::info("[FB] Packs: '{}' events={} timelines={}{}",
+					files[i].filename().string(), r.data.eventToTimeline.size(), r.data.timelines.size() + r.data.lazyTimelines.size(),
+					r.cacheHit ? " (cache)" : "");
+			}
+			MergeSource(newCfg, std::move(r.data), files[i].filename().string(), state);
+		}
+
+		MergeSource(newCfg, std::move(main), newCfg.sourcePath.filename().string(), state);
+
+		spdlog::info("[FB] Packs: merged {} of {} files from '{}' in {:.1f}ms ({} from cache)",
+			loaded, files.size(), GetPackDirectory().string(), elapsedMs, cacheHits);
+	}
+
+	// Hot reload: a pack was added, removed or rewritten since cfg was loaded.
+	static bool PacksChanged(const FB::Config::ConfigData& cfg)
+	{
+		const auto files = FindPackFiles();
+		if (files.size() != cfg.packSources.size()) {
+			return true;
 		}
 
+		for (std::size_t i = 0; i < files.size(); ++i) {
+			std::error_code ec;
+			const auto writeTime = std::filesystem::last_write_time(files[i], ec);
+			if (files[i] != cfg.packSources[i].path || ec || writeTime != cfg.packSources[i].writeTime) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Parse the INI (and any timeline packs) into a fresh snapshot. Touches no shared state except reading g_resolver.
+	static FB::Config::ConfigPtr LoadConfig()
+	{
+		auto out = std::make_shared<FB::Config::ConfigData>();
+		auto& newCfg = *out;
+		const auto resolver = g_resolver.load(std::memory_order_acquire);
+
+		auto path = GetConfigPathPreferred();
+		auto text = std::make_shared<std::string>();
+		bool found = ReadWholeFile(path, *text);
+
+		if (!found) {
+			auto fb = GetConfigPathFallback();
+			if (ReadWholeFile(fb, *text)) {
+				found = true;
+				path = fb;
+				spdlog::info("[FB] Using fallback config path: {}", path.string());
+			}
+		}
+
+		if (found) {
+			spdlog::info("[FB] Config path: {}", path.string());
+
+			newCfg.sourcePath = path;
+			{
+				std::error_code ec;
+				newCfg.sourceWriteTime = std::filesystem::last_write_time(path, ec);
+			}
+
+			ParseSourceFile(path, text, newCfg, resolver, false);
+		}
+		else {
+			spdlog::warn("[FB] Config not found: {} (and fallback missing: {}) - using defaults",
+				GetConfigPathPreferred().string(),
+				GetConfigPathFallback().string());
+		}
+
+		// Packs load even without a main INI (they then parse under default debug flags).
+		LoadPacks(newCfg, resolver);
+
+		BuildEventFilter(newCfg);
+
 		spdlog::info(
-			"[FB] Config loaded: enableTimelines={} resetOnPairEnd={} resetOnPairedStop={} resetMorphsOnPairEnd={} resetMorphsOnPairedStop={} eventMaps={} timelines={}",
+			"[FB] Config loaded: enableTimelines={} resetOnPairEnd={} resetOnPairedStop={} resetMorphsOnPairEnd={} resetMorphsOnPairedStop={} eventMaps={} timelines={} lazy={} packs={}",
 			newCfg.enableTimelines,
 			newCfg.resetOnPairEnd,
 			newCfg.resetOnPairedStop,
 			newCfg.resetMorphsOnPairEnd,
 			newCfg.resetMorphsOnPairedStop,
 			newCfg.eventToTimeline.size(),
-			newCfg.timelines.size());
+			newCfg.timelines.size(),
+			newCfg.lazyTimelines.size(),
+			newCfg.packSources.size());
+
+		return out;
+	}
+
+	static void WatchConfigFile(std::stop_token stop)
+	{
+		std::mutex m;
+		std::condition_variable_any cv;
+
+		while (!stop.stop_requested()) {
+			{
+				std::unique_lock lk(m);
+				cv.wait_for(lk, stop, kHotReloadPollInterval, [] { return false; });
+			}
+			if (stop.stop_requested()) {
+				break;
+			}
 
-		g_cfg = std::move(newCfg);
-		g_loaded = true;
+			const auto cfg = g_cfg.load(std::memory_order_acquire);
+			if (!cfg || !cfg->dbg.hotReload) {
+				continue;
+			}
+
+			const auto path = cfg->sourcePath.empty() ? GetConfigPathPreferred() : cfg->sourcePath;
+
+			std::error_code ec;
+			const auto writeTime = std::filesystem::last_write_time(path, ec);
+			const bool mainChanged = !ec && writeTime != cfg->sourceWriteTime;
+			if (!mainChanged && !PacksChanged(*cfg)) {
+				continue;
+			}
+
+			spdlog::info("[FB] Hot reload: '{}' changed, reloading", mainChanged ? path.string() : GetPackDirectory().string());
+
+			// Already off the game thread: parse here, then swap the snapshot in.
+			FB::Config::Reload(nullptr);
+		}
+	}
+
+	static void WarmTimelines(std::stop_token stop, FB::Config::ConfigPtr cfg)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		std::size_t compiled = 0;
+		for (const auto& [name, lazy] : cfg->lazyTimelines) {
+			if (stop.stop_requested()) {
+				return;
+			}
+			if (!lazy->Compiled()) {
+				lazy->Get();
+				++compiled;
+			}
+		}
+
+		spdlog::info("[FB] Warm-up: compiled {} of {} lazy timelines in {:.1f}ms",
+			compiled,
+			cfg->lazyTimelines.size(),
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	// Caller holds g_loadMutex
+	static void StartWarmUpLocked(const FB::Config::ConfigPtr& cfg)
+	{
+		if (!cfg || !cfg->lazyCompile || !cfg->warmTimelines || cfg->lazyTimelines.empty()) {
+			return;
+		}
+		g_warmer = std::jthread(&WarmTimelines, cfg);
+	}
+
+	// Caller holds g_loadMutex
+	static void PublishLocked(FB::Config::ConfigPtr cfg)
+	{
+		const bool hotReload = cfg->dbg.hotReload;
+		FB::Log::Configure(cfg->dbg.log);
+		FB_STATS_SET_INTERVAL(cfg->dbg.statsLogSeconds);
+		FB::Morph::SetNativeEnabled(cfg->nativeMorphs);
+		FB::Scheduler::SetBudget(cfg->frameBudgetMicros);
+		FB::Scheduler::SetLod(cfg->lod);
+		if (g_warmRequested.load(std::memory_order_relaxed)) {
+			StartWarmUpLocked(cfg);
+		}
+		g_cfg.store(std::move(cfg), std::memory_order_release);
+
+		if (hotReload && !g_watcher.joinable()) {
+			g_watcher = std::jthread(&WatchConfigFile);
+			spdlog::info("[FB] Hot reload: watching config for changes");
+		}
 	}
 }
 
 namespace FB::Config
 {
-	const ConfigData& Get(NodeKeyResolver resolver)
+	ConfigPtr Get(NodeKeyResolver resolver)
 	{
-		std::lock_guard _{ g_cfgMutex };
-		if (resolver) {
-			g_resolver = resolver;
+		if (resolver && g_resolver.load(std::memory_order_relaxed) != resolver) {
+			g_resolver.store(resolver, std::memory_order_release);
+		}
+
+		if (auto cfg = g_cfg.load(std::memory_order_acquire)) {
+			return cfg;
 		}
-		if (!g_loaded) {
-			LoadConfigLocked();
+
+		// First use: load once under the writer lock
+		std::lock_guard _{ g_loadMutex };
+		if (auto cfg = g_cfg.load(std::memory_order_acquire)) {
+			return cfg;
 		}
-		return g_cfg;
+
+		auto cfg = LoadConfig();
+		PublishLocked(cfg);
+		return cfg;
 	}
 
 	void Reload(NodeKeyResolver resolver)
 	{
-		std::lock_guard _{ g_cfgMutex };
 		if (resolver) {
-			g_resolver = resolver;
+			g_resolver.store(resolver, std::memory_order_release);
+		}
+
+		std::lock_guard _{ g_loadMutex };
+		PublishLocked(LoadConfig());
+	}
+
+	void ReloadAsync(NodeKeyResolver resolver)
+	{
+		if (resolver) {
+			g_resolver.store(resolver, std::memory_order_release);
+		}
+
+		std::thread([]() { Reload(nullptr); }).detach();
+	}
+
+	void WarmTimelinesAsync()
+	{
+		g_warmRequested.store(true, std::memory_order_relaxed);
+
+		std::lock_guard _{ g_loadMutex };
+		StartWarmUpLocked(g_cfg.load(std::memory_order_acquire));
+	}
+
+	TimelinePtr LazyTimeline::Get() const
+	{
+		if (auto compiled = _compiled.load(std::memory_order_acquire)) {
+			return compiled;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		const std::string_view text = *_source;
+
+		std::vector<FB::TimedCommand> cmds;
+		for (const auto& section : _sections) {
+			ParseTimelineSection(text.substr(section.offset, section.size), section.name, _name, section.who,
+				_strictIni, _logIni, _resolver, cmds);
+		}
+		SortAndClamp(cmds);
+
+		TimelinePtr compiled = CompileTimeline(cmds);
+		TimelinePtr expected;
+		if (!_compiled.compare_exchange_strong(expected, compiled, std::memory_order_acq_rel)) {
+			return expected;  // another thread finished first
+		}
+
+		if (_logIni) {
+			spdlog::info("[FB] INI: compiled timeline '{}' on first use: cmds={} in {:.2f}ms",
+				_name,
+				compiled->CommandCount(),
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return compiled;
+	}
+
+	std::size_t CaseFoldHash::operator()(std::string_view s) const noexcept
+	{
+		// FNV-1a over ASCII-lowercased bytes
+		std::uint64_t h = 14695981039346656037ull;
+		for (const char c : s) {
+			h ^= static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c)));
+			h *= 1099511628211ull;
+		}
+		return static_cast<std::size_t>(h);
+	}
+
+	bool CaseFoldEqual::operator()(std::string_view a, std::string_view b) const noexcept
+	{
+		if (a.size() != b.size()) {
+			return false;
+		}
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+				return false;
+			}
 		}
-		g_loaded = false;
-		LoadConfigLocked();
+		return true;
 	}
 }
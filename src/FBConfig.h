@@ -1,7 +1,13 @@
 #pragma once
 
 #include "ActorManager.h"  // FB::TimedCommand
+#include "FBLog.h"         // FB::Log::Settings
+#include "FBScaler.h"      // FB::Scaler::NodeId
+#include "FBScheduler.h"   // FB::Scheduler::LodSettings
 
+#include <atomic>
+#include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -10,9 +16,9 @@
 
 namespace FB::Config
 {
-	// AnimationEvents owns the "public API" mapping from NodeKey -> canonical node string_view.
+	// AnimationEvents owns the "public API" mapping from NodeKey -> compact skeleton node ID.
 	// FBConfig needs it to validate and translate NodeKeys while parsing.
-	using NodeKeyResolver = std::optional<std::string_view>(*)(std::string_view);
+	using NodeKeyResolver = std::optional<FB::Scaler::NodeId>(*)(std::string_view);
 
 	struct DebugConfig
 	{
@@ -24,6 +30,97 @@ namespace FB::Config
 		bool resetMorphsOnPairEnd{ true };
 		bool resetMorphsOnPairedStop{ true };
 
+		// Watch the loaded INI and reload it (off the game thread) when it changes on disk.
+		bool hotReload{ false };
+
+		// Log pipeline (bAsyncLog / iLogQueueSize / iLogFlushSeconds / iLogRateLimit); applied on every publish.
+		FB::Log::Settings log{};
+
+		// Log an [FB] Stats summary this often (0 = only on demand via the "fb stats" console command).
+		std::uint32_t statsLogSeconds{ 60 };
+
+		// Reuse compiled timelines from <ini>.fbcache when the INI is unchanged (bConfigCache).
+		bool configCache{ true };
+	};
+
+	// Compiled timeline; shared between the config, the start-event filter and any running ActiveTimeline.
+	using TimelinePtr = FB::TimelinePtr;
+
+	// Case-insensitive hashing/equality with heterogeneous string_view lookup (no key allocation).
+	struct CaseFoldHash
+	{
+		using is_transparent = void;
+		std::size_t operator()(std::string_view s) const noexcept;
+	};
+
+	struct CaseFoldEqual
+	{
+		using is_transparent = void;
+		bool operator()(std::string_view a, std::string_view b) const noexcept;
+	};
+
+	// Lazy mode ([General] LazyTimelines): a timeline's [FB:...] sections kept as byte ranges into
+	// their source file, compiled the first time Get() is called and cached in place.
+	class LazyTimeline
+	{
+	public:
+		struct Section
+		{
+			std::string name;  // section header, for diagnostics
+			FB::TargetKind who{ FB::TargetKind::kCaster };
+			std::size_t offset{ 0 };
+			std::size_t size{ 0 };
+		};
+
+		LazyTimeline(std::string name, std::shared_ptr<const std::string> source, NodeKeyResolver resolver, bool strictIni, bool logIni) :
+			_name(std::move(name)), _source(std::move(source)), _resolver(resolver), _strictIni(strictIni), _logIni(logIni) {}
+
+		void AddSection(Section section) { _sections.push_back(std::move(section)); }
+
+		// Compiled timeline; compiles on the first call. Thread-safe: racing callers may both compile,
+		// one result is kept for everybody.
+		TimelinePtr Get() const;
+
+		bool Compiled() const { return _compiled.load(std::memory_order_acquire) != nullptr; }
+
+	private:
+		std::string _name;
+		std::shared_ptr<const std::string> _source;
+		std::vector<Section> _sections;
+		NodeKeyResolver _resolver{ nullptr };
+		bool _strictIni{ true };
+		bool _logIni{ true };
+
+		mutable std::atomic<TimelinePtr> _compiled;
+	};
+
+	using LazyTimelinePtr = std::shared_ptr<const LazyTimeline>;
+
+	// A start tag pre-resolved to its timeline at config load.
+	struct StartEvent
+	{
+		std::string timeline;
+		TimelinePtr commands{};
+
+		// Lazy mode: set instead of commands until first use
+		LazyTimelinePtr lazy{};
+
+		TimelinePtr Commands() const { return commands ? commands : lazy ? lazy->Get() : nullptr; }
+	};
+
+	// Built once per config load as part of the snapshot, so the animation event sink can
+	// reject "not our event" tags without locking or allocating.
+	// Only contains tags whose timeline exists and has commands (lazy timelines: has sections; they may
+	// still compile empty); empty when timelines are disabled.
+	struct EventFilter
+	{
+		std::unordered_map<std::string, StartEvent, CaseFoldHash, CaseFoldEqual> startEvents;
+
+		const StartEvent* Find(std::string_view tag) const
+		{
+			const auto it = startEvents.find(tag);
+			return it == startEvents.end() ? nullptr : std::addressof(it->second);
+		}
 	};
 
 	struct ConfigData
@@ -38,18 +135,69 @@ namespace FB::Config
 		bool resetMorphsOnPairEnd{ true };
 		bool resetMorphsOnPairedStop{ true };  // optional but recommended for parity
 
+		// Write morphs through RaceMenu's native BodyMorph interface when present (else FBMorphBridge.psc)
+		bool nativeMorphs{ true };
+
+		// Index [FB:...] sections at load and compile each timeline on first use (LazyTimelines),
+		// optionally compiling all of them on a background thread after kDataLoaded (WarmTimelines).
+		bool lazyCompile{ false };
+		bool warmTimelines{ true };
+
+		// Drive each timeline from the playing clip's local time (animation file = timeline name)
+		// instead of accumulated frame time, where the clip can be found on the caster's graph.
+		bool syncToClipTime{ false };
+
+		// Per-frame budget (microseconds; 0 = unlimited) for work that may wait for a later frame:
+		// off-screen (LOD-culled) timelines, culled sticky morph values, restores for unloaded casters (FB::Scheduler).
+		std::uint32_t frameBudgetMicros{ 1000 };
+
+		// Effect LOD thresholds ([General] LodFarDistance / LodFarUpdateHz / LodCullDistance)
+		FB::Scheduler::LodSettings lod{};
+
 		DebugConfig dbg{};
 
-		// StartEventTag -> TimelineName
-		std::unordered_map<std::string, std::string> eventToTimeline;
+		// StartEventTag -> TimelineName. Tags match case-insensitively (as the event filter does), so a
+		// later line or pack that differs only in case replaces the earlier mapping.
+		std::unordered_map<std::string, std::string, CaseFoldHash, CaseFoldEqual> eventToTimeline;
+
+		// TimelineName -> compiled timeline (per-kind arrays sorted by time, immutable once loaded)
+		std::unordered_map<std::string, TimelinePtr> timelines;
+
+		// Lazy mode: TimelineName -> not-yet-compiled timeline (a name is in one of the two maps)
+		std::unordered_map<std::string, LazyTimelinePtr> lazyTimelines;
 
-		// TimelineName -> commands
-		std::unordered_map<std::string, std::vector<FB::TimedCommand>> timelines;
+		// Start tags pre-resolved to timelines (see EventFilter)
+		EventFilter startEvents;
+
+		// File this snapshot was parsed from (empty when defaults were used), for hot reload
+		std::filesystem::path sourcePath;
+		std::filesystem::file_time_type sourceWriteTime{};
+
+		// Timeline pack files merged into this snapshot (merge order), for hot reload
+		struct PackSource
+		{
+			std::filesystem::path path;
+			std::filesystem::file_time_type writeTime{};
+		};
+		std::vector<PackSource> packSources;
 	};
 
-	// Get cached config (lazy-load on first call). Resolver must be provided at least once.
-	const ConfigData& Get(NodeKeyResolver resolver);
+	// Published configs are immutable snapshots; hold the pointer for as long as you use the data.
+	using ConfigPtr = std::shared_ptr<const ConfigData>;
+
+	// Current config snapshot (lazy-load on first call). Resolver must be provided at least once.
+	// After the first load readers never block on the loader/parse mutex; safe from any thread.
+	// (std::atomic<std::shared_ptr> is not lock-free: the load may take a short internal lock.)
+	ConfigPtr Get(NodeKeyResolver resolver);
 
-	// Force reload from disk using resolver.
+	// Force reload from disk using resolver (nullptr keeps the last one) and publish the new snapshot.
+	// Parsing happens on the calling thread; readers never wait for it.
 	void Reload(NodeKeyResolver resolver);
+
+	// Same as Reload, on a background thread.
+	void ReloadAsync(NodeKeyResolver resolver);
+
+	// Compile the current snapshot's lazy timelines on a background thread (no-op unless WarmTimelines).
+	// Also re-warms every later reload. Call once the game data is loaded.
+	void WarmTimelinesAsync();
 }
@@ -0,0 +1,324 @@
+#include "FBConfigCache.h"
+#include "FBMorph.h"  // InternMorph / MorphName
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	constexpr std::array<char, 4> kMagic{ 'F', 'B', 'C', 'C' };
+
+	// Bump whenever the serialized layout or the meaning of a stored value changes.
+	// NodeId values are stored raw, so the node table size is part of the format too.
+	constexpr std::uint32_t kFormatVersion = 1;
+	constexpr std::uint32_t kNodeCount = static_cast<std::uint32_t>(FB::Scaler::kNodeCount);
+
+	class Writer
+	{
+	public:
+		template <class T>
+		void Put(T v)
+		{
+			static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+			const auto* p = reinterpret_cast<const char*>(std::addressof(v));
+			_buf.append(p, sizeof(T));
+		}
+
+		void Put(std::string_view s)
+		{
+			Put(static_cast<std::uint32_t>(s.size()));
+			_buf.append(s.data(), s.size());
+		}
+
+		const std::string& Data() const noexcept { return _buf; }
+
+	private:
+		std::string _buf;
+	};
+
+	class Reader
+	{
+	public:
+		explicit Reader(std::string_view data) :
+			_rest(data) {}
+
+		template <class T>
+		bool Get(T& v)
+		{
+			static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+			if (_rest.size() < sizeof(T)) {
+				return false;
+			}
+			std::memcpy(std::addressof(v), _rest.data(), sizeof(T));
+			_rest.remove_prefix(sizeof(T));
+			return true;
+		}
+
+		bool Get(std::string& s)
+		{
+			std::uint32_t n = 0;
+			if (!Get(n) || _rest.size() < n) {
+				return false;
+			}
+			s.assign(_rest.data(), n);
+			_rest.remove_prefix(n);
+			return true;
+		}
+
+		// Element counts are bounded by what is left, so a corrupt count can't trigger a huge allocation.
+		bool GetCount(std::uint32_t& n, std::size_t minElementSize)
+		{
+			return Get(n) && static_cast<std::size_t>(n) * minElementSize <= _rest.size();
+		}
+
+		bool AtEnd() const noexcept { return _rest.empty(); }
+
+	private:
+		std::string_view _rest;
+	};
+
+	static void PutTimeline(Writer& w, const FB::CompiledTimeline& tl)
+	{
+		w.Put(static_cast<std::uint32_t>(tl.scales.size()));
+		for (const auto& e : tl.scales) {
+			w.Put(e.timeSeconds);
+			w.Put(e.node);
+			w.Put(e.target);
+			w.Put(e.scale);
+			w.Put(e.tweenSeconds);
+		}
+
+		w.Put(static_cast<std::uint32_t>(tl.morphs.size()));
+		for (const auto& e : tl.morphs) {
+			w.Put(e.timeSeconds);
+			w.Put(e.target);
+			w.Put(e.tweenCurve);
+			w.Put(FB::Morph::MorphName(e.morph));  // IDs are per process; names are re-interned on load
+			w.Put(e.delta);
+			w.Put(e.tweenSeconds);
+		}
+
+		w.Put(static_cast<std::uint32_t>(tl.hides.size()));
+		for (const auto& e : tl.hides) {
+			w.Put(e.timeSeconds);
+			w.Put(e.target);
+			w.Put(e.hideMode);
+			w.Put(e.hideSlot);
+			w.Put(e.hide);
+		}
+
+		w.Put(static_cast<std::uint32_t>(tl.order.size()));
+		for (const auto& e : tl.order) {
+			w.Put(e.timeSeconds);
+			w.Put(e.kind);
+			w.Put(e.index);
+		}
+	}
+
+	static bool GetTimeline(Reader& r, FB::CompiledTimeline& tl)
+	{
+		std::uint32_t n = 0;
+
+		if (!r.GetCount(n, 1)) {
+			return false;
+		}
+		tl.scales.resize(n);
+		for (auto& e : tl.scales) {
+			if (!r.Get(e.timeSeconds) || !r.Get(e.node) || !r.Get(e.target) || !r.Get(e.scale) || !r.Get(e.tweenSeconds)) {
+				return false;
+			}
+			if (static_cast<std::uint32_t>(e.node) >= kNodeCount) {
+				return false;
+			}
+		}
+
+		if (!r.GetCount(n, 1)) {
+			return false;
+		}
+		tl.morphs.resize(n);
+		std::string name;
+		for (auto& e : tl.morphs) {
+			if (!r.Get(e.timeSeconds) || !r.Get(e.target) || !r.Get(e.tweenCurve) || !r.Get(name) || !r.Get(e.delta) || !r.Get(e.tweenSeconds)) {
+				return false;
+			}
+			e.morph = FB::Morph::InternMorph(name);
+			if (e.morph == FB::Morph::kInvalidMorphId) {
+				return false;
+			}
+		}
+
+		if (!r.GetCount(n, 1)) {
+			return false;
+		}
+		tl.hides.resize(n);
+		for (auto& e : tl.hides) {
+			if (!r.Get(e.timeSeconds) || !r.Get(e.target) || !r.Get(e.hideMode) || !r.Get(e.hideSlot) || !r.Get(e.hide)) {
+				return false;
+			}
+		}
+
+		if (!r.GetCount(n, 1)) {
+			return false;
+		}
+		tl.order.resize(n);
+		for (auto& e : tl.order) {
+			if (!r.Get(e.timeSeconds) || !r.Get(e.kind) || !r.Get(e.index)) {
+				return false;
+			}
+
+			// The dispatch stream indexes the payload arrays directly; never trust it blindly.
+			std::size_t bound = 0;
+			switch (e.kind) {
+			case FB::CommandKind::kScale:
+				bound = tl.scales.size();
+				break;
+			case FB::CommandKind::kMorph:
+				bound = tl.morphs.size();
+				break;
+			case FB::CommandKind::kHide:
+				bound = tl.hides.size();
+				break;
+			default:
+				return false;
+			}
+			if (e.index >= bound) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+namespace FB::Config::Cache
+{
+	SourceKey MakeKey(const std::filesystem::path& source, std::string_view contents)
+	{
+		SourceKey key;
+		key.size = contents.size();
+
+		std::error_code ec;
+		const auto writeTime = std::filesystem::last_write_time(source, ec);
+		key.writeTime = ec ? 0 : static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+
+		std::uint64_t h = 14695981039346656037ull;
+		for (const char c : contents) {
+			h ^= static_cast<unsigned char>(c);
+			h *= 1099511628211ull;
+		}
+		key.hash = h;
+		return key;
+	}
+
+	std::filesystem::path PathFor(const std::filesystem::path& source)
+	{
+		auto path = source;
+		path.replace_extension(".fbcache");
+		return path;
+	}
+
+	bool Load(const std::filesystem::path& cachePath, const SourceKey& key, Payload& out)
+	{
+		std::ifstream in(cachePath, std::ios::binary | std::ios::ate);
+		if (!in.good()) {
+			return false;
+		}
+
+		const auto size = static_cast<std::streamoff>(in.tellg());
+		if (size <= 0) {
+			return false;
+		}
+
+		std::string data(static_cast<std::size_t>(size), '\0');
+		in.seekg(0);
+		if (!in.read(data.data(), size)) {
+			return false;
+		}
+
+		Reader r{ data };
+
+		std::array<char, 4> magic{};
+		std::uint32_t version = 0;
+		std::uint32_t nodeCount = 0;
+		SourceKey stored;
+		for (auto& c : magic) {
+			if (!r.Get(c)) {
+				return false;
+			}
+		}
+		if (magic != kMagic || !r.Get(version) || version != kFormatVersion || !r.Get(nodeCount) || nodeCount != kNodeCount) {
+			return false;
+		}
+		if (!r.Get(stored.size) || !r.Get(stored.writeTime) || !r.Get(stored.hash) || stored != key) {
+			return false;
+		}
+
+		Payload payload;
+		std::uint32_t n = 0;
+
+		if (!r.GetCount(n, 4)) {
+			return false;
+		}
+		for (std::uint32_t i = 0; i < n; ++i) {
+			std::string name;
+			auto tl = std::make_shared<FB::CompiledTimeline>();
+			if (!r.Get(name) || !GetTimeline(r, *tl)) {
+				return false;
+			}
+			payload.timelines.emplace(std::move(name), std::move(tl));
+		}
+
+		if (!r.AtEnd()) {
+			return false;
+		}
+
+		out = std::move(payload);
+		return true;
+	}
+
+	bool Store(const std::filesystem::path& cachePath, const SourceKey& key, const Payload& payload)
+	{
+		Writer w;
+		for (const char c : kMagic) {
+			w.Put(c);
+		}
+		w.Put(kFormatVersion);
+		w.Put(kNodeCount);
+		w.Put(key.size);
+		w.Put(key.writeTime);
+		w.Put(key.hash);
+
+		w.Put(static_cast<std::uint32_t>(payload.timelines.size()));
+		for (const auto& [name, tl] : payload.timelines) {
+			w.Put(std::string_view{ name });
+			static const FB::CompiledTimeline kEmpty{};
+			PutTimeline(w, tl ? *tl : kEmpty);
+		}
+
+		auto tmp = cachePath;
+		tmp += ".tmp";
+		{
+			std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+			if (!out.write(w.Data().data(), static_cast<std::streamsize>(w.Data().size()))) {
+				spdlog::warn("[FB] Config cache: could not write '{}'", tmp.string());
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tmp, cachePath, ec);
+		if (ec) {
+			spdlog::warn("[FB] Config cache: could not replace '{}': {}", cachePath.string(), ec.message());
+			std::filesystem::remove(tmp, ec);
+			return false;
+		}
+		return true;
+	}
+}
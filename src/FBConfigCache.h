@@ -0,0 +1,41 @@
+#pragma once
+
+#include "FBConfig.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace FB::Config::Cache
+{
+	// Identity of a parsed INI. A cache entry is only used when all three match the file on disk.
+	struct SourceKey
+	{
+		std::uint64_t size{ 0 };
+		std::int64_t writeTime{ 0 };  // file_time_type ticks
+		std::uint64_t hash{ 0 };      // FNV-1a over the file contents
+
+		bool operator==(const SourceKey&) const = default;
+	};
+
+	SourceKey MakeKey(const std::filesystem::path& source, std::string_view contents);
+
+	// <ini stem>.fbcache next to the INI.
+	std::filesystem::path PathFor(const std::filesystem::path& source);
+
+	// What the expensive part of a load produces: the compiled [FB:...] timelines.
+	// [General]/[Debug]/[EventToTimeline] are not cached; they are a cheap line scan, re-read on every load.
+	struct Payload
+	{
+		std::unordered_map<std::string, TimelinePtr> timelines;
+	};
+
+	// Fill out from cachePath if it exists, has the current format version and was written for key.
+	// Morph names are re-interned; out is untouched on a miss.
+	bool Load(const std::filesystem::path& cachePath, const SourceKey& key, Payload& out);
+
+	// Write payload for key (atomically: temp file + rename). Failures are logged and otherwise ignored.
+	bool Store(const std::filesystem::path& cachePath, const SourceKey& key, const Payload& payload);
+}
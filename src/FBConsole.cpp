@@ -0,0 +1,86 @@
+#include "FBConsole.h"
+#include "FBConfig.h"
+#include "FBStats.h"
+
+#include "RE/Skyrim.h"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	constexpr auto kLongName = "FullBodied";
+	constexpr auto kShortName = "fb";
+	constexpr auto kHelp = "FullBodied diagnostics: fb stats";
+
+	std::atomic_bool g_installed{ false };
+
+	static void Print(std::string_view line)
+	{
+		if (auto* console = RE::ConsoleLog::GetSingleton()) {
+			console->Print("%.*s", static_cast<int>(line.size()), line.data());
+		}
+	}
+
+	static bool Execute(
+		const RE::SCRIPT_PARAMETER*,
+		RE::SCRIPT_FUNCTION::ScriptData* a_scriptData,
+		RE::TESObjectREFR*,
+		RE::TESObjectREFR*,
+		RE::Script*,
+		RE::ScriptLocals*,
+		double&,
+		std::uint32_t&)
+	{
+		// The whole argument is one optional string; read it straight from the compiled command.
+		std::string arg;
+		if (a_scriptData && a_scriptData->numParams > 0) {
+			if (auto* chunk = a_scriptData->GetStringChunk()) {
+				arg = chunk->GetString();
+			}
+		}
+
+		if (FB::Config::CaseFoldEqual{}(arg, "stats")) {
+			for (const auto& line : FB::Stats::Summarize()) {
+				Print(line);
+			}
+			return true;
+		}
+
+		Print(kHelp);
+		return true;
+	}
+}
+
+namespace FB::Console
+{
+	void Install()
+	{
+		bool expected = false;
+		if (!g_installed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+			return;
+		}
+
+		auto* cmd = RE::SCRIPT_FUNCTION::LocateConsoleCommand("BetaComment");
+		if (!cmd) {
+			spdlog::warn("[FB] Console: BetaComment not found; 'fb' command unavailable");
+			return;
+		}
+
+		static RE::SCRIPT_PARAMETER params[] = {
+			{ "String", RE::SCRIPT_PARAM_TYPE::kChar, true },
+		};
+
+		cmd->functionName = kLongName;
+		cmd->shortName = kShortName;
+		cmd->helpString = kHelp;
+		cmd->referenceFunction = false;
+		cmd->SetParameters(params);
+		cmd->executeFunction = &Execute;
+
+		spdlog::info("[FB] Console: registered '{}' ({})", kShortName, kLongName);
+	}
+}
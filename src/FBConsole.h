@@ -0,0 +1,9 @@
+#pragma once
+
+namespace FB::Console
+{
+	// Register the "fb" console command (takes over the unused BetaComment slot):
+	//   fb stats   print the FB::Stats summary for the window since the last summary
+	// Call once at kDataLoaded.
+	void Install();
+}
@@ -0,0 +1,29 @@
+#include "FBFrameClock.h"
+
+#include <atomic>
+
+namespace
+{
+	// Single writer (the pump); readers on any thread only need a coherent value, not ordering.
+	std::atomic<FB::FrameClock::Ticks> g_now{ 0 };
+	std::atomic<std::uint64_t> g_frame{ 0 };
+}
+
+namespace FB::FrameClock
+{
+	void Advance(float dtSeconds)
+	{
+		g_now.store(g_now.load(std::memory_order_relaxed) + FromSeconds(dtSeconds), std::memory_order_relaxed);
+		g_frame.store(g_frame.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	Ticks Now() noexcept
+	{
+		return g_now.load(std::memory_order_relaxed);
+	}
+
+	std::uint64_t Frame() noexcept
+	{
+		return g_frame.load(std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+namespace FB::FrameClock
+{
+	// Plugin-wide game clock. The update pump advances it once per frame with the same clamped dt it
+	// hands to the timeline runtime, so anything timed against it (start debounce, sticky morph hold
+	// and tween windows) pauses, slows down and absorbs hitches exactly like the timelines do.
+	// Reading it is a relaxed atomic load: no clock syscall, no lock.
+
+	// Game time in microseconds since the pump started
+	using Ticks = std::uint64_t;
+
+	inline constexpr Ticks kTicksPerSecond = 1'000'000;
+
+	constexpr Ticks FromSeconds(float seconds) noexcept
+	{
+		return seconds > 0.0f ? static_cast<Ticks>(static_cast<double>(seconds) * kTicksPerSecond + 0.5) : 0;
+	}
+
+	constexpr float ToSeconds(Ticks ticks) noexcept
+	{
+		return static_cast<float>(static_cast<double>(ticks) / kTicksPerSecond);
+	}
+
+	// Advance by one frame of dtSeconds (already clamped by the caller). Update pump only.
+	void Advance(float dtSeconds);
+
+	// Current game time. Any thread.
+	Ticks Now() noexcept;
+
+	// Frames advanced so far. Any thread.
+	std::uint64_t Frame() noexcept;
+}
@@ -1,12 +1,18 @@
 #include "FBHide.h"
+#include "FBActorRegistry.h"
+#include "FBLog.h"
+#include "FBStats.h"
 
 #include <RE/B/BSGeometry.h>
 #include <RE/B/BSDismemberSkinInstance.h>
 #include <RE/N/NiNode.h>
 #include <RE/N/NiRTTI.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -17,12 +23,62 @@ namespace FB::Hide
 {
     namespace
     {
+        // Flat view of one 3D instance, built once per root and reused by every hide/unhide/reset.
+        struct GeometryIndex
+        {
+            // Identity of the 3D root the index was built from; a different root means the 3D was reloaded.
+            RE::NiPointer<RE::NiAVObject> root;
+
+            // RootSignature(root) at build time: equipping armor attaches new nodes under the root.
+            std::uint64_t rootSignature{ 0 };
+
+            // Renderable geometry under root, in traversal order.
+            // Held by reference so a piece detached by an equipment change stays valid until we rebuild.
+            std::vector<RE::NiPointer<RE::NiAVObject>> geoms;
+
+            // Bit i => geoms[i] was hidden before we touched it (captured when the index is built)
+            std::vector<bool> baselineHidden;
+
+            // Dismember skin instances found on those geometries (slot hide / restore)
+            std::vector<RE::NiPointer<RE::BSDismemberSkinInstance>> dismemberSkins;
+
+            // Every dismember partition, sorted by slot: a slot toggle is an equal_range plus a few flag writes.
+            struct PartitionRef
+            {
+                std::uint16_t slot{ 0 };
+                std::uint16_t skin{ 0 };       // index into dismemberSkins
+                std::int32_t  partition{ 0 };  // index into that skin's partitions
+                bool          baselineVisible{ true };
+            };
+            std::vector<PartitionRef> partitions;
+
+            std::span<PartitionRef> PartitionsForSlot(std::uint16_t slot)
+            {
+                const auto [first, last] = std::ranges::equal_range(partitions, slot, {}, &PartitionRef::slot);
+                return { first, last };
+            }
+
+            bool Matches(const RE::NiAVObject* a_root, std::uint64_t a_rootSignature) const
+            {
+                if (root.get() != a_root || rootSignature != a_rootSignature) {
+                    return false;
+                }
+                // Geometry removed since the build (unequip) has lost its parent: rebuild.
+                for (const auto& g : geoms) {
+                    if (!g->parent) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
         struct ActorHideState
         {
-            // Baseline: whether object was hidden before we touched it
-            std::unordered_map<const RE::NiAVObject*, bool> baselineHiddenByObj;
-            // Touched list for reset iteration
-            std::vector<const RE::NiAVObject*> touched;
+            GeometryIndex index;
+
+            // We changed kHidden on index.geoms since the last reset
+            bool touchedGeometry{ false };
 
             // Slots we toggled via dismember (best-effort restore)
             std::unordered_set<std::uint16_t> touchedSlots;
@@ -32,15 +88,42 @@ namespace FB::Hide
 
             void Clear()
             {
-                baselineHiddenByObj.clear();
-                touched.clear();
+                index = {};
+                touchedGeometry = false;
                 touchedSlots.clear();
                 loggedNoDismemberSlots.clear();
             }
         };
 
+        // Indexed by FB::ActorRegistry slot; generation is the slot generation the state was built for.
+        struct HideEntry
+        {
+            std::uint32_t generation{ 0 };
+            ActorHideState state;
+        };
+
         std::mutex g_mutex;
-        std::unordered_map<std::uint32_t, ActorHideState> g_stateByActorID;
+        std::array<HideEntry, FB::ActorRegistry::kCapacity> g_states;
+
+        // Caller holds g_mutex. State left by a previous holder of the slot is discarded.
+        static ActorHideState& GetStateLocked(FB::ActorRegistry::Slot slot)
+        {
+            auto& entry = g_states[slot.index];
+            if (entry.generation != slot.generation) {
+                entry.generation = slot.generation;
+                entry.state.Clear();
+            }
+            return entry.state;
+        }
+
+        // Caller holds g_mutex. Null if the actor has no hide state.
+        static ActorHideState* FindStateLocked(FB::ActorRegistry::Slot slot)
+        {
+            if (!slot.Valid() || g_states[slot.index].generation != slot.generation) {
+                return nullptr;
+            }
+            return std::addressof(g_states[slot.index].state);
+        }
 
         static std::uint32_t GetActorID(const RE::ActorHandle& a_handle)
         {
@@ -56,57 +139,66 @@ namespace FB::Hide
             return actor ? actor->Get3D() : nullptr;
         }
 
-        static bool IsRenderableGeometry(RE::NiAVObject* a_obj)
+        static void SetHiddenFlag(RE::NiAVObject* a_obj, bool a_hidden)
         {
             if (!a_obj) {
-                return false;
+                return;
             }
-            // BSGeometry covers most skinned renderables; BSTriShape is also common
-            if (netimmerse_cast<RE::BSGeometry*>(a_obj)) {
-                return true;
+
+            auto& flags = a_obj->GetFlags();
+            if (a_hidden) {
+                flags.set(RE::NiAVObject::Flag::kHidden);
             }
-            if (netimmerse_cast<RE::BSTriShape*>(a_obj)) {
-                return true;
+            else {
+                flags.reset(RE::NiAVObject::Flag::kHidden);
             }
-            return false;
         }
 
-        static void TraverseNode(RE::NiAVObject* a_obj, std::vector<RE::NiAVObject*>& a_out)
+        static bool GetHiddenFlag(RE::NiAVObject* a_obj)
         {
-            if (!a_obj) {
-                return;
-            }
+            return a_obj ? a_obj->GetFlags().all(RE::NiAVObject::Flag::kHidden) : false;
+        }
 
-            if (IsRenderableGeometry(a_obj)) {
-                a_out.push_back(a_obj);
+        // Cheap structural fingerprint of the root: its direct children (count and identity), which is where
+        // equipment changes attach and detach armor. Deeper removals are caught by the parent check in Matches.
+        static std::uint64_t RootSignature(RE::NiAVObject* a_root)
+        {
+            auto* node = a_root ? netimmerse_cast<RE::NiNode*>(a_root) : nullptr;
+            if (!node) {
+                return 0;
             }
 
-            if (auto* node = netimmerse_cast<RE::NiNode*>(a_obj)) {
-                auto& kids = node->GetChildren();
-                const auto n = kids.size();
-                for (std::size_t i = 0; i < n; ++i) {
-                    auto& child = kids[i];
-                    if (child) {
-                        TraverseNode(child.get(), a_out);
-                    }
+            std::uint64_t signature = 0;
+            std::uint64_t count = 0;
+            auto& kids = node->GetChildren();
+            const auto n = kids.size();
+            for (std::size_t i = 0; i < n; ++i) {
+                if (auto& child = kids[i]) {
+                    // Order-sensitive mix of the child pointers (FNV-1a style)
+                    signature = (signature ^ reinterpret_cast<std::uintptr_t>(child.get())) * 0x100000001B3ull;
+                    ++count;
                 }
             }
+            return signature ^ (count << 56);
         }
 
-        static void TraverseGeometry(RE::NiAVObject* a_obj, std::vector<RE::BSGeometry*>& a_out)
+        // One pass, one RTTI cast per object: BSTriShape derives from BSGeometry, and geometry has no children.
+        static void CollectGeometry(RE::NiAVObject* a_obj, GeometryIndex& a_index)
         {
             if (!a_obj) {
                 return;
             }
 
             if (auto* geo = netimmerse_cast<RE::BSGeometry*>(a_obj)) {
-                a_out.push_back(geo);
-            }
-            else if (auto* tri = netimmerse_cast<RE::BSTriShape*>(a_obj)) {
-                // In many builds BSTriShape is also a BSGeometry; if not, this keeps us safe.
-                if (auto* asGeo = netimmerse_cast<RE::BSGeometry*>(tri)) {
-                    a_out.push_back(asGeo);
+                a_index.geoms.emplace_back(a_obj);
+                a_index.baselineHidden.push_back(GetHiddenFlag(a_obj));
+
+                if (auto* skin = geo->GetGeometryRuntimeData().skinInstance.get()) {
+                    if (auto* dismember = netimmerse_cast<RE::BSDismemberSkinInstance*>(skin)) {
+                        a_index.dismemberSkins.emplace_back(dismember);
+                    }
                 }
+                return;
             }
 
             if (auto* node = netimmerse_cast<RE::NiNode*>(a_obj)) {
@@ -115,30 +207,77 @@ namespace FB::Hide
                 for (std::size_t i = 0; i < n; ++i) {
                     auto& child = kids[i];
                     if (child) {
-                        TraverseGeometry(child.get(), a_out);
+                        CollectGeometry(child.get(), a_index);
                     }
                 }
             }
         }
 
-        static void SetHiddenFlag(RE::NiAVObject* a_obj, bool a_hidden)
+        static void BuildPartitionMap(GeometryIndex& a_index)
         {
-            if (!a_obj) {
-                return;
+            for (std::size_t s = 0; s < a_index.dismemberSkins.size(); ++s) {
+                auto& data = a_index.dismemberSkins[s]->GetRuntimeData();
+                for (std::int32_t p = 0; p < data.numPartitions; ++p) {
+                    const auto& part = data.partitions[p];
+                    a_index.partitions.push_back({ part.slot, static_cast<std::uint16_t>(s), p, part.editorVisible });
+                }
             }
 
-            auto& flags = a_obj->GetFlags();
-            if (a_hidden) {
-                flags.set(RE::NiAVObject::Flag::kHidden);
-            }
-            else {
-                flags.reset(RE::NiAVObject::Flag::kHidden);
-            }
+            std::ranges::stable_sort(a_index.partitions, {}, &GeometryIndex::PartitionRef::slot);
         }
 
-        static bool GetHiddenFlag(RE::NiAVObject* a_obj)
+        static RE::BSDismemberSkinInstance::Data& GetPartition(GeometryIndex& a_index, const GeometryIndex::PartitionRef& a_ref)
         {
-            return a_obj ? a_obj->GetFlags().all(RE::NiAVObject::Flag::kHidden) : false;
+            return a_index.dismemberSkins[a_ref.skin]->GetRuntimeData().partitions[a_ref.partition];
+        }
+
+        // Caller holds g_mutex. Returns the index for root, rebuilding it if the 3D changed (reload, or
+        // armor equipped/unequipped since the build).
+        static GeometryIndex& GetIndexLocked(ActorHideState& a_state, RE::NiAVObject* a_root)
+        {
+            auto& index = a_state.index;
+            const auto signature = RootSignature(a_root);
+            if (index.Matches(a_root, signature)) {
+                return index;
+            }
+
+            GeometryIndex rebuilt;
+            rebuilt.root = RE::NiPointer<RE::NiAVObject>(a_root);
+            rebuilt.rootSignature = signature;
+            rebuilt.geoms.reserve(index.geoms.empty() ? 64 : index.geoms.size());
+            CollectGeometry(a_root, rebuilt);
+            BuildPartitionMap(rebuilt);
+
+            // Geometry we already hid would now read as hidden; keep the baseline captured before we touched it.
+            if (a_state.touchedGeometry && !index.geoms.empty()) {
+                std::unordered_map<const RE::NiAVObject*, bool> previous;
+                previous.reserve(index.geoms.size());
+                for (std::size_t i = 0; i < index.geoms.size(); ++i) {
+                    previous.emplace(index.geoms[i].get(), index.baselineHidden[i]);
+                }
+                for (std::size_t i = 0; i < rebuilt.geoms.size(); ++i) {
+                    if (auto it = previous.find(rebuilt.geoms[i].get()); it != previous.end()) {
+                        rebuilt.baselineHidden[i] = it->second;
+                    }
+                }
+            }
+
+            // Same for partitions of slots we hid: the same skin instance keeps its pre-hide visibility.
+            for (auto slot : a_state.touchedSlots) {
+                const auto before = index.PartitionsForSlot(slot);
+                for (auto& ref : rebuilt.PartitionsForSlot(slot)) {
+                    const auto* skin = rebuilt.dismemberSkins[ref.skin].get();
+                    for (const auto& old : before) {
+                        if (index.dismemberSkins[old.skin].get() == skin && old.partition == ref.partition) {
+                            ref.baselineVisible = old.baselineVisible;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            index = std::move(rebuilt);
+            return index;
         }
     }
 
@@ -149,51 +288,65 @@ namespace FB::Hide
             return;
         }
 
+        FB_STATS_ADD(kHideOps, 1);
+
         auto* root = GetRoot3D(a_actor);
-        if (!root) {
+        const auto slot = FB::ActorRegistry::Acquire(actorID);
+        if (!root || !slot.Valid()) {
             return;
         }
 
-        std::vector<RE::NiAVObject*> geoms;
-        geoms.reserve(256);
-        TraverseNode(root, geoms);
-
         std::scoped_lock lk(g_mutex);
-        auto& state = g_stateByActorID[actorID];
-
-        for (auto* obj : geoms) {
-            if (!obj) {
-                continue;
-            }
-
-            if (!state.baselineHiddenByObj.contains(obj)) {
-                const bool baseline = GetHiddenFlag(obj);
-                state.baselineHiddenByObj.emplace(obj, baseline);
-                state.touched.push_back(obj);
-            }
+        auto& state = GetStateLocked(slot);
+        auto& index = GetIndexLocked(state, root);
 
-            if (a_hide) {
-                SetHiddenFlag(obj, true);
-            }
-            else {
-                const bool baseline = state.baselineHiddenByObj[obj];
-                SetHiddenFlag(obj, baseline);
-            }
+        const auto n = index.geoms.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            SetHiddenFlag(index.geoms[i].get(), a_hide || index.baselineHidden[i]);
         }
+        state.touchedGeometry = true;
 
-        if (logOps) {
-            spdlog::info("[FBHide] ApplyHide: actor {:08X} hide={} touchedNow={}", actorID, a_hide, geoms.size());
+        if (logOps && FB::Log::Allow(FB::Log::Category::kHide)) {
+            spdlog::info("[FBHide] ApplyHide: actor {:08X} hide={} touchedNow={}", actorID, a_hide, n);
         }
     }
 
     void ApplyHideSlot(RE::ActorHandle a_actor, std::uint16_t slotNumber, bool hide, bool logOps)
     {
-        if (logOps) {
-            const auto actorID = GetActorID(a_actor);
-            spdlog::info("[FBHide] ApplyHideSlot: actor {:08X} slot={} hide={} (stub/no-op)", actorID, slotNumber, hide);
+        const auto actorID = GetActorID(a_actor);
+        if (actorID == 0) {
+            return;
+        }
+
+        FB_STATS_ADD(kHideOps, 1);
+
+        auto* root = GetRoot3D(a_actor);
+        const auto slot = FB::ActorRegistry::Acquire(actorID);
+        if (!root || !slot.Valid()) {
+            return;
         }
-    }
 
+        std::scoped_lock lk(g_mutex);
+        auto& state = GetStateLocked(slot);
+        auto& index = GetIndexLocked(state, root);
+
+        const auto refs = index.PartitionsForSlot(slotNumber);
+        if (refs.empty()) {
+            if (logOps && state.loggedNoDismemberSlots.insert(slotNumber).second) {
+                spdlog::info("[FBHide] ApplyHideSlot: actor {:08X} has no dismember partitions for slot {}", actorID, slotNumber);
+            }
+            return;
+        }
+
+        for (const auto& ref : refs) {
+            GetPartition(index, ref).editorVisible = hide ? false : ref.baselineVisible;
+        }
+        state.touchedSlots.insert(slotNumber);
+
+        if (logOps && FB::Log::Allow(FB::Log::Category::kHide)) {
+            spdlog::info("[FBHide] ApplyHideSlot: actor {:08X} slot={} hide={} partitions={}", actorID, slotNumber, hide, refs.size());
+        }
+    }
 
     void ResetActor(RE::ActorHandle a_actor, bool logOps)
     {
@@ -202,49 +355,34 @@ namespace FB::Hide
             return;
         }
 
+        FB_STATS_ADD(kHideOps, 1);
+
         auto* root = GetRoot3D(a_actor);
+        const auto slot = FB::ActorRegistry::Find(actorID);
 
         std::scoped_lock lk(g_mutex);
-        auto it = g_stateByActorID.find(actorID);
-        if (it == g_stateByActorID.end()) {
+        auto* found = FindStateLocked(slot);
+        if (!found) {
             return;
         }
 
-        auto& state = it->second;
+        auto& state = *found;
 
         if (root) {
+            auto& index = GetIndexLocked(state, root);
+
             // Restore kHidden baselines
-            for (auto* obj : state.touched) {
-                auto jt = state.baselineHiddenByObj.find(obj);
-                if (jt != state.baselineHiddenByObj.end()) {
-                    SetHiddenFlag(const_cast<RE::NiAVObject*>(obj), jt->second);
+            if (state.touchedGeometry) {
+                const auto n = index.geoms.size();
+                for (std::size_t i = 0; i < n; ++i) {
+                    SetHiddenFlag(index.geoms[i].get(), index.baselineHidden[i]);
                 }
             }
 
-            // Best-effort restore of dismember slots: enable them again
-            if (!state.touchedSlots.empty()) {
-                std::vector<RE::BSGeometry*> geoms;
-                geoms.reserve(256);
-                TraverseGeometry(root, geoms);
-
-                for (auto* geo : geoms) {
-                    if (!geo) {
-                        continue;
-                    }
-
-                    auto* skin = geo->GetGeometryRuntimeData().skinInstance.get();
-                    if (!skin) {
-                        continue;
-                    }
-
-                    auto* dismember = netimmerse_cast<RE::BSDismemberSkinInstance*>(skin);
-                    if (!dismember) {
-                        continue;
-                    }
-
-                    for (auto slot : state.touchedSlots) {
-                        dismember->UpdateDismemberPartion(slot, true);
-                    }
+            // Restore dismember slots we toggled to their pre-hide visibility
+            for (auto slot : state.touchedSlots) {
+                for (const auto& ref : index.PartitionsForSlot(slot)) {
+                    GetPartition(index, ref).editorVisible = ref.baselineVisible;
                 }
             }
         }
@@ -255,18 +393,33 @@ namespace FB::Hide
         }
 
         state.Clear();
-        g_stateByActorID.erase(it);
 
         if (logOps) {
             spdlog::info("[FBHide] ResetActor: actor {:08X} done", actorID);
         }
     }
 
+    void ForgetActor(FB::ActorRegistry::Slot slot)
+    {
+        std::scoped_lock lk(g_mutex);
+        if (auto* state = FindStateLocked(slot)) {
+            state->Clear();
+        }
+    }
+
+    void ForgetAll()
+    {
+        std::scoped_lock lk(g_mutex);
+        for (auto& entry : g_states) {
+            entry.generation = 0;
+            entry.state.Clear();
+        }
+    }
+
 #ifndef NDEBUG
     void ResetAll(bool logOps)
     {
-        std::scoped_lock lk(g_mutex);
-        g_stateByActorID.clear();
+        ForgetAll();
 
         if (logOps) {
             spdlog::info("[FBHide] ResetAll: cleared all hide state");
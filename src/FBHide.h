@@ -2,21 +2,31 @@
 
 #include "RE/Skyrim.h"
 
+#include "FBActorRegistry.h"
+
 namespace FB::Hide
 {
 	// Hide/unhide every renderable geometry under the actor's 3D root.
-	// On first touch per-actor, we cache the baseline hidden flag and restore it when un-hiding.
+	// The first touch per 3D instance builds a flat geometry index (with baseline hidden flags) that
+	// later hide/unhide/reset calls reuse; un-hiding restores the baseline.
 	void ApplyHide(RE::ActorHandle a_actor, bool a_hide, bool logOps);
 
-	// Best-effort slot-based hide using BSDismember partitions.
-	// If no eligible dismember skin instances are found, this is a no-op (and can log once per slot).
+	// Slot-based hide using BSDismember partitions: flips only the partitions mapped to slotNumber
+	// (slot -> partition map is built with the geometry index, once per 3D instance).
+	// If the actor has no partitions for that slot, this is a no-op (and can log once per slot).
 	void ApplyHideSlot(RE::ActorHandle actor, std::uint16_t slotNumber, bool hide, bool logOps);
 
 	// Clears cached baseline/touched state for this actor; attempts to restore baseline if 3D is present.
 	void ResetActor(RE::ActorHandle a_actor, bool logOps);
 
+	// Drops all state (and the cached geometry index) for an actor whose 3D unloaded; no restore is attempted.
+	void ForgetActor(FB::ActorRegistry::Slot slot);
+
+	// ForgetActor for every actor at once (new game / save loaded); no restore is attempted.
+	void ForgetAll();
+
 #ifndef NDEBUG
-	// Debug only: clears all cached state.
+	// Debug only: ForgetAll, logged.
 	void ResetAll(bool logOps);
 #endif
 }
@@ -0,0 +1,154 @@
+#include "FBLog.h"
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+namespace
+{
+	constexpr auto kLoggerName = "global";
+	constexpr auto kPattern = "[%Y-%m-%d %H:%M:%S.%e] [%l] %v";
+
+	constexpr std::array<std::string_view, static_cast<std::size_t>(FB::Log::Category::kCount)> kCategoryNames{
+		"NodeScale",
+		"MorphBridgeCall",
+		"MorphOp",
+		"Hide",
+	};
+
+	// One-second fixed window per category
+	struct RateWindow
+	{
+		std::atomic<std::int64_t> second{ 0 };
+		std::atomic<std::uint32_t> count{ 0 };
+		std::atomic<std::uint32_t> suppressed{ 0 };
+	};
+
+	std::array<RateWindow, static_cast<std::size_t>(FB::Log::Category::kCount)> g_windows;
+	std::atomic<std::uint32_t> g_rateLimit{ FB::Log::Settings{}.rateLimitPerSecond };
+
+	// Configure() state
+	std::mutex g_configMutex;
+	spdlog::sink_ptr g_fileSink;
+	bool g_async{ false };
+	bool g_modeFixed{ false };  // the first Configure chose sync/async; later ones keep it
+
+	static void Install(std::shared_ptr<spdlog::logger> logger)
+	{
+		logger->set_level(spdlog::level::info);
+		logger->set_pattern(kPattern);
+		spdlog::set_default_logger(std::move(logger));
+	}
+}
+
+namespace FB::Log
+{
+	void Init(const std::filesystem::path& path)
+	{
+		std::lock_guard _{ g_configMutex };
+
+		g_fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path.string(), true);
+
+		// Start synchronous so load-time diagnostics are on disk even if we crash before the INI is read.
+		auto logger = std::make_shared<spdlog::logger>(kLoggerName, g_fileSink);
+		logger->flush_on(spdlog::level::info);
+		Install(std::move(logger));
+		g_async = false;
+	}
+
+	void Configure(const Settings& settings)
+	{
+		g_rateLimit.store(settings.rateLimitPerSecond, std::memory_order_relaxed);
+
+		std::lock_guard _{ g_configMutex };
+		if (!g_fileSink) {
+			return;
+		}
+
+		const auto flushInterval = std::chrono::seconds(settings.flushSeconds > 0 ? settings.flushSeconds : 1);
+
+		// The default logger is replaced at most once, by the first publish (kDataLoaded on the game
+		// thread, before any sink, pump or worker thread logs). Every spdlog::info goes through
+		// default_logger_raw() without holding a reference, so replacing it later (hot reload, ReloadAsync)
+		// could destroy the logger in the middle of another thread's call. A later bAsyncLog change
+		// therefore waits for a restart; the ring buffer size is fixed the same way.
+		if (g_modeFixed) {
+			if (settings.async != g_async) {
+				spdlog::info("[FB] Log: bAsyncLog={} takes effect after a restart (mode stays {})",
+					settings.async, g_async ? "async" : "sync");
+			}
+			else if (g_async) {
+				spdlog::flush_every(flushInterval);
+			}
+			return;
+		}
+		g_modeFixed = true;
+
+		if (settings.async) {
+			spdlog::init_thread_pool(settings.queueSize, 1);
+			spdlog::flush_every(flushInterval);
+		}
+
+		if (settings.async == g_async) {
+			return;
+		}
+
+		if (settings.async) {
+			auto logger = std::make_shared<spdlog::async_logger>(
+				kLoggerName,
+				g_fileSink,
+				spdlog::thread_pool(),
+				spdlog::async_overflow_policy::overrun_oldest);
+			logger->flush_on(spdlog::level::warn);
+			Install(std::move(logger));
+		}
+		else {
+			auto logger = std::make_shared<spdlog::logger>(kLoggerName, g_fileSink);
+			logger->flush_on(spdlog::level::info);
+			Install(std::move(logger));
+		}
+
+		g_async = settings.async;
+		spdlog::info("[FB] Log: mode={} queueSize={} flushSeconds={} rateLimitPerSecond={}",
+			g_async ? "async" : "sync",
+			settings.queueSize,
+			settings.flushSeconds,
+			settings.rateLimitPerSecond);
+	}
+
+	bool Allow(Category category)
+	{
+		const auto limit = g_rateLimit.load(std::memory_order_relaxed);
+		if (limit == 0) {
+			return true;
+		}
+
+		const auto idx = static_cast<std::size_t>(category);
+		auto& w = g_windows[idx];
+
+		const std::int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		auto second = w.second.load(std::memory_order_relaxed);
+		if (second != now && w.second.compare_exchange_strong(second, now, std::memory_order_relaxed)) {
+			w.count.store(0, std::memory_order_relaxed);
+			if (const auto dropped = w.suppressed.exchange(0, std::memory_order_relaxed); dropped > 0) {
+				spdlog::info("[FB] Log: suppressed {} '{}' lines (limit {}/s)", dropped, kCategoryNames[idx], limit);
+			}
+		}
+
+		if (w.count.fetch_add(1, std::memory_order_relaxed) < limit) {
+			return true;
+		}
+
+		w.suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+}
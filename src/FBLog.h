@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace FB::Log
+{
+	// Repetitive per-operation lines that get rate limited (see Settings::rateLimitPerSecond).
+	enum class Category : std::uint8_t
+	{
+		kNodeScale,
+		kMorphBridgeCall,
+		kMorphOp,
+		kHide,
+
+		kCount
+	};
+
+	struct Settings
+	{
+		// Async: a background thread writes from a bounded ring buffer (oldest lines dropped when
+		// full, the game thread never blocks on disk). Sync: every line is written and flushed inline.
+		bool async{ true };
+		std::size_t queueSize{ 8192 };
+
+		// Async only: flush batched writes this often (warnings and errors always flush immediately).
+		std::uint32_t flushSeconds{ 1 };
+
+		// Max lines per second per Category; 0 = unlimited. Suppressed counts are reported once per second.
+		std::uint32_t rateLimitPerSecond{ 20 };
+	};
+
+	// Create the file logger (synchronous) as the default spdlog logger. Called once at plugin load.
+	void Init(const std::filesystem::path& path);
+
+	// Apply limits after the INI is (re)loaded. Keeps the same file. The sync/async mode (and queue
+	// size) is taken from the first call only; later calls leave the installed logger in place.
+	void Configure(const Settings& settings);
+
+	// True if a line of this category may be logged now. Cheap (a few relaxed atomics) and thread-safe.
+	bool Allow(Category category);
+}
@@ -1,161 +1,276 @@
 #include "FBMorph.h"
-
-#include "RE/F/FunctionArguments.h"
-#include "RE/S/SkyrimVM.h"
-#include "SKSE/SKSE.h"
+#include "FBMorphWriter.h"
+#include "FBActorRegistry.h"
+#include "FBFrameClock.h"
+#include "FBScheduler.h"
+#include "FBLog.h"
+#include "FBStats.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
-#include <chrono>
 #include <cstdint>
 #include <cmath>
 #include <mutex>
 #include <string>
-#include <thread>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace
 {
-    using Clock = std::chrono::steady_clock;
+    // Sticky timing runs on the plugin's game clock, in step with the timeline runtime.
+    using Ticks = FB::FrameClock::Ticks;
+
+    constexpr Ticks kStickyTweenTicks = FB::FrameClock::FromSeconds(0.40f);  // 0.4s tween
+    constexpr Ticks kStickyIdleTicks = FB::FrameClock::FromSeconds(0.85f);   // held this long after the tween
 
     std::mutex g_mutex;
 
-    // Accumulated values by actorFormID -> (morphKey -> value)
-    // morphKey here is the logical key coming from FBConfig (e.g. "PregnancyBelly").
-    std::unordered_map<std::uint32_t, std::unordered_map<std::string, float>> g_values;
+    struct StringViewHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
+    //
+    // Morph table  MorphId -> names. Fixed capacity so a published entry never moves: readers index it
+    // without a lock (an ID only exists once InternMorph has published its entry).
+    //
+    constexpr std::size_t kMaxMorphs = 1024;
+
+    struct MorphInfo
+    {
+        std::string logicalKey;          // e.g. "PregnancyBelly"
+        RE::BSFixedString rmMorphName;   // pooled RaceMenu morph name we call into (usually same as logicalKey)
+    };
+
+    std::mutex g_tableMutex;  // writers only
+    std::array<MorphInfo, kMaxMorphs> g_morphTable;
+    std::atomic<std::uint32_t> g_morphCount{ 0 };
+    std::unordered_map<std::string, FB::Morph::MorphId, StringViewHash, std::equal_to<>> g_morphIds;  // guarded by g_tableMutex
+
+    // Per-actor state, indexed by MorphId (grown to the highest ID the actor has used, never shrunk,
+    // so value updates and resets don't allocate).
+    constexpr std::uint32_t kNoSticky = UINT32_MAX;
+
+    struct MorphSlot
+    {
+        float value{ 0.0f };                 // accumulated logical value
+        std::uint32_t sticky{ kNoSticky };   // index into g_sticky while this morph is being re-applied
+    };
+
+    struct ActorMorphs
+    {
+        std::uint32_t generation{ 0 };  // registry slot generation these values belong to
+        std::uint32_t formID{ 0 };
+        std::vector<MorphSlot> slots;
+    };
+
+    // Indexed by FB::ActorRegistry slot. Guarded by g_mutex.
+    std::array<ActorMorphs, FB::ActorRegistry::kCapacity> g_actors;
 
     struct StickyEntry
     {
-        std::string logicalKey;     // e.g. "PregnancyBelly"
-        std::string rmMorphName;    // actual RaceMenu morph name we call into (usually same as logicalKey)
+        RE::ActorHandle actor;
+        std::uint32_t formID{ 0 };
+        FB::ActorRegistry::Slot actorSlot;
+
+        FB::Morph::MorphId morph{ FB::Morph::kInvalidMorphId };
 
-        // Current displayed value (what we last sent via FBSetMorph)
+        // Current displayed value (what we last sent via FBSetMorphs)
         float value{ 0.0f };
 
         // Tween state: we smoothly animate from fromValue -> toValue over [startTime, endTime]
         float fromValue{ 0.0f };
         float toValue{ 0.0f };
-        Clock::time_point startTime{};
-        Clock::time_point endTime{};
+        Ticks startTime{ 0 };
+        Ticks endTime{ 0 };
         bool tweenActive{ false };
 
-        // How often the worker re-applies the current value
+        // How often the scheduler re-applies the current value
         float intervalSeconds{ 0.05f };  // 20 Hz
+        Ticks nextApply{ 0 };
 
         // Keep reapplying until this time (extended each AddDelta)
-        Clock::time_point holdUntil{};
+        Ticks holdUntil{ 0 };
+
+        // Culled actor whose tween just finished: its final value goes out only if the frame has budget left
+        bool finalDue{ false };
 
-        std::atomic_bool running{ false };
+        bool logOps{ false };
     };
 
-    // actorFormID -> (logicalKey -> sticky entry)
-    std::unordered_map<std::uint32_t, std::unordered_map<std::string, std::shared_ptr<StickyEntry>>> g_sticky;
+    // Flat list of active sticky entries, one per (actor, morph); MorphSlot::sticky points back here.
+    // Ticked on the game thread by UpdateSticky(); expired entries are swap-removed (RemoveStickyLocked).
+    std::vector<StickyEntry> g_sticky;
 
-    static float Clamp(float v)
+    // Per-frame morph batch: writes collected during a tick, flushed once per actor.
+    struct PendingWrite
     {
-        return std::clamp(v, FB::Morph::kMinValue, FB::Morph::kMaxValue);
-    }
+        FB::Morph::MorphId morph{ FB::Morph::kInvalidMorphId };
+        float value{ 0.0f };
+    };
 
-    // Map *logical* key from FBConfig -> actual RaceMenu morph name.
-    // In the current design we just pass it through:
-    //   FBMorph_PregnancyBelly(...) -> "PregnancyBelly"
-    //   FBMorph_BreastsNewSH(...)   -> "BreastsNewSH"
-    //
-    // If you ever want aliases or nicer INI names, this is the place to map them.
-    static const char* ResolveRaceMenuMorphName(std::string_view key)
+    struct PendingActor
     {
-        // Example of explicit alias, if desired:
-        // if (key == FB::Morph::kMorph_VorePreyBelly) {
-        //     return "Vore Prey Belly";
-        // }
+        RE::ActorHandle actor;
+        std::uint32_t formID{ 0 };
 
-        // Default: treat INI key as the actual morph name
-        // (must match RaceMenu slider name exactly)
-        return key.data();
-    }
+        // Only [0, count) is live; entries past it are kept for reuse.
+        std::vector<PendingWrite> writes;
+        std::size_t count{ 0 };
 
-    static RE::BSScript::IVirtualMachine* GetVM()
-    {
-        auto* skyrimVM = RE::SkyrimVM::GetSingleton();
-        return skyrimVM ? skyrimVM->impl.get() : nullptr;
-    }
+        // Any queued write came from an AddDelta with logOps: the flush logs its bridge call.
+        bool logOps{ false };
 
-    //
-    // Bridge helpers  call into FBMorphBridge.psc, which talks to NiOverride.
-    //
-    // Papyrus side:
-    //   Function FBSetMorph(Actor akActor, String morphName, Float value) Global
-    //   Function FBClearMorphs(Actor akActor) Global
-    //
+        // ResetAllForActor: clear this plugin's morphs before applying the writes (same flush, same order).
+        bool clear{ false };
+    };
 
-    static void Papyrus_FBSetMorph(RE::Actor* actor, const char* morphName, float value, bool logOps)
+    // Guarded by g_mutex. Slots are recycled after a flush (formID == 0) so their
+    // write vectors keep their capacity and steady-state ticks don't allocate.
+    std::vector<PendingActor> g_pending;
+
+    // FlushPending's per-actor name/value arrays, cleared and refilled for each actor (game thread only).
+    std::vector<RE::BSFixedString> g_flushNames;
+    std::vector<float> g_flushValues;
+
+    // The actor's pending entry, taking a recycled one (or appending) on first use; caller holds g_mutex.
+    static PendingActor& GetPendingLocked(RE::ActorHandle actor, std::uint32_t formID)
     {
-        if (!actor || !morphName) {
-            return;
+        PendingActor* slot = nullptr;
+        PendingActor* freeSlot = nullptr;
+        for (auto& p : g_pending) {
+            if (p.formID == formID) {
+                slot = std::addressof(p);
+                break;
+            }
+            if (p.formID == 0 && !freeSlot) {
+                freeSlot = std::addressof(p);
+            }
         }
 
-        auto* vm = GetVM();
-        if (!vm) {
-            if (logOps) {
-                spdlog::warn("[FB] Morph: SkyrimVM/IVirtualMachine not available");
+        if (!slot) {
+            if (!freeSlot) {
+                freeSlot = std::addressof(g_pending.emplace_back());
             }
-            return;
+            slot = freeSlot;
+            slot->actor = actor;
+            slot->formID = formID;
+            slot->count = 0;
+            slot->logOps = false;
+            slot->clear = false;
         }
+        return *slot;
+    }
 
-        RE::BSTSmartPointer<RE::BSScript::IStackCallbackFunctor> result{};
+    // Last write per (actor, morph) wins; caller holds g_mutex.
+    static void QueueWriteLocked(RE::ActorHandle actor, std::uint32_t formID, FB::Morph::MorphId morph, float value, bool logOps)
+    {
+        auto* slot = std::addressof(GetPendingLocked(actor, formID));
+        slot->logOps |= logOps;
 
-        // FBMorphBridge.FBSetMorph(Actor akActor, String morphName, Float value)
-        auto* args = RE::MakeFunctionArguments(
-            static_cast<RE::Actor*>(actor),
-            RE::BSFixedString(morphName),
-            static_cast<float>(value));
+        for (std::size_t i = 0; i < slot->count; ++i) {
+            if (slot->writes[i].morph == morph) {
+                slot->writes[i].value = value;
+                return;
+            }
+        }
 
-        const bool ok = vm->DispatchStaticCall(
-            RE::BSFixedString("FBMorphBridge"),
-            RE::BSFixedString("FBSetMorph"),
-            args,
-            result);
+        if (slot->count == slot->writes.size()) {
+            slot->writes.emplace_back();
+        }
+        auto& w = slot->writes[slot->count++];
+        w.morph = morph;
+        w.value = value;
+    }
 
-        if (logOps) {
-            spdlog::info("[FB] MorphBridgeCall: FBSetMorph={} morph='{}' value={}", ok, morphName, value);
+    // The actor's entry, emptied first if the registry slot has changed hands since it was filled.
+    static ActorMorphs& GetActorLocked(FB::ActorRegistry::Slot actorSlot, std::uint32_t formID)
+    {
+        auto& a = g_actors[actorSlot.index];
+        if (a.generation != actorSlot.generation) {
+            a.generation = actorSlot.generation;
+            a.slots.clear();  // keeps capacity
         }
+        a.formID = formID;
+        return a;
     }
 
-    static void Papyrus_FBClearMorphs(RE::Actor* actor, bool logOps)
+    static MorphSlot* FindSlotLocked(FB::ActorRegistry::Slot actorSlot, FB::Morph::MorphId morph)
     {
-        if (!actor) {
-            return;
+        if (!actorSlot.Valid()) {
+            return nullptr;
         }
+        auto& a = g_actors[actorSlot.index];
+        if (a.generation != actorSlot.generation || morph >= a.slots.size()) {
+            return nullptr;
+        }
+        return std::addressof(a.slots[morph]);
+    }
 
-        auto* vm = GetVM();
-        if (!vm) {
-            if (logOps) {
-                spdlog::warn("[FB] Morph: SkyrimVM/IVirtualMachine not available");
+    // Swap-remove g_sticky[i], keeping the back-index of the entry moved into its place current.
+    static void RemoveStickyLocked(std::size_t i)
+    {
+        if (auto* slot = FindSlotLocked(g_sticky[i].actorSlot, g_sticky[i].morph)) {
+            slot->sticky = kNoSticky;
+        }
+
+        if (i + 1 != g_sticky.size()) {
+            g_sticky[i] = std::move(g_sticky.back());
+            if (auto* slot = FindSlotLocked(g_sticky[i].actorSlot, g_sticky[i].morph)) {
+                slot->sticky = static_cast<std::uint32_t>(i);
             }
-            return;
         }
+        g_sticky.pop_back();
+    }
 
-        RE::BSTSmartPointer<RE::BSScript::IStackCallbackFunctor> result{};
+    static void DropActorLocked(std::uint32_t formID)
+    {
+        for (std::size_t i = g_sticky.size(); i-- > 0; ) {
+            if (g_sticky[i].formID == formID) {
+                RemoveStickyLocked(i);
+            }
+        }
+
+        // Drop queued writes so the next flush doesn't re-apply over a clear
+        for (auto& p : g_pending) {
+            if (p.formID == formID) {
+                p.formID = 0;
+                p.count = 0;
+                p.clear = false;
+            }
+        }
+    }
 
-        // FBMorphBridge.FBClearMorphs(Actor akActor)
-        auto* args = RE::MakeFunctionArguments(
-            static_cast<RE::Actor*>(actor));
+    static float Clamp(float v)
+    {
+        return std::clamp(v, FB::Morph::kMinValue, FB::Morph::kMaxValue);
+    }
 
-        const bool ok = vm->DispatchStaticCall(
-            RE::BSFixedString("FBMorphBridge"),
-            RE::BSFixedString("FBClearMorphs"),
-            args,
-            result);
+    // Map *logical* key from FBConfig -> actual RaceMenu morph name.
+    // In the current design we just pass it through:
+    //   FBMorph_PregnancyBelly(...) -> "PregnancyBelly"
+    //   FBMorph_BreastsNewSH(...)   -> "BreastsNewSH"
+    //
+    // If you ever want aliases or nicer INI names, this is the place to map them.
+    static const char* ResolveRaceMenuMorphName(std::string_view key)
+    {
+        // Example of explicit alias, if desired:
+        // if (key == FB::Morph::kMorph_VorePreyBelly) {
+        //     return "Vore Prey Belly";
+        // }
 
-        if (logOps) {
-            spdlog::info("[FB] MorphBridgeCall: FBClearMorphs={} key='{}'", ok, FB::Morph::kMorphKey);
-        }
+        // Default: treat INI key as the actual morph name
+        // (must match RaceMenu slider name exactly)
+        return key.data();
     }
 
     //
-    // Sticky worker  keeps reapplying the current morph value AND drives the tween.
+    // Sticky scheduler  keeps reapplying the current morph value AND drives the tween.
     //
 
     static float EaseInOutQuad(float t)
@@ -168,195 +283,229 @@ namespace
         return 1.0f - (u * u) / 2.0f;
     }
 
-    static void EnsureStickyWorker(
-        RE::ActorHandle actor,
-        std::uint32_t formID,
-        const std::shared_ptr<StickyEntry>& entry,
-        bool logOps)
+    // Advances one entry to 'now'. Returns false once its hold window has expired.
+    static bool TickStickyLocked(StickyEntry& entry, Ticks now)
     {
-        // Start worker once.
-        bool expected = false;
-        if (!entry->running.compare_exchange_strong(expected, true)) {
-            return;
+        // Stop if the "hold" window expired
+        if (now > entry.holdUntil) {
+            return false;
         }
 
-        std::thread([actor, formID, entry, logOps]() {
-            while (true) {
-                // Sleep for the configured interval (20 Hz, min 10ms)
-                const auto sleepMs =
-                    static_cast<int>(std::max(10.0f, entry->intervalSeconds * 1000.0f));
-                std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs));
-
-                float valueToApply = 0.0f;
-                std::string morphNameCopy;
-
-                {
-                    std::lock_guard _{ g_mutex };
-
-                    const auto now = Clock::now();
-
-                    // Stop if the "hold" window expired
-                    if (now > entry->holdUntil) {
-                        break;
-                    }
-
-                    morphNameCopy = entry->rmMorphName;
+        // Not due yet (20 Hz re-apply, min 10ms)
+        if (now < entry.nextApply) {
+            return true;
+        }
 
-                    if (entry->tweenActive) {
-                        if (now >= entry->endTime) {
-                            // Tween finished  snap to final
-                            entry->value = entry->toValue;
-                            entry->tweenActive = false;
-                        }
-                        else {
-                            const auto total = entry->endTime - entry->startTime;
-                            const auto elapsed = now - entry->startTime;
+        entry.nextApply = now + FB::FrameClock::FromSeconds(std::max(0.01f, entry.intervalSeconds));
 
-                            const float totalMs = static_cast<float>(
-                                std::chrono::duration_cast<std::chrono::milliseconds>(total).count());
-                            const float elapsedMs = static_cast<float>(
-                                std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+        if (entry.tweenActive) {
+            if (now >= entry.endTime) {
+                // Tween finished  snap to final
+                entry.value = entry.toValue;
+                entry.tweenActive = false;
+            }
+            else {
+                const float total = FB::FrameClock::ToSeconds(entry.endTime - entry.startTime);
+                const float elapsed = FB::FrameClock::ToSeconds(now - entry.startTime);
 
-                            float t = (totalMs > 0.0f) ? (elapsedMs / totalMs) : 1.0f;
-                            t = std::clamp(t, 0.0f, 1.0f);
+                float t = (total > 0.0f) ? (elapsed / total) : 1.0f;
+                t = std::clamp(t, 0.0f, 1.0f);
 
-                            const float eased = EaseInOutQuad(t);
-                            const float v = entry->fromValue +
-                                (entry->toValue - entry->fromValue) * eased;
+                const float eased = EaseInOutQuad(t);
+                entry.value = entry.fromValue + (entry.toValue - entry.fromValue) * eased;
+            }
+        }
 
-                            entry->value = v;
-                        }
-                    }
+        // Re-apply current value with the next batch flush.
+        // No logging here to avoid spam  this is just keeping the value alive / tweened.
+        QueueWriteLocked(entry.actor, entry.formID, entry.morph, entry.value, entry.logOps);
+        return true;
+    }
+}  // namespace
 
-                    valueToApply = entry->value;
-                }
+namespace FB::Morph
+{
+    MorphId InternMorph(std::string_view morphKey)
+    {
+        if (morphKey.empty()) {
+            return kInvalidMorphId;
+        }
 
-                // Re-apply current value on the game thread
-                auto* task = SKSE::GetTaskInterface();
-                if (!task) {
-                    continue;
-                }
+        std::lock_guard _{ g_tableMutex };
+        if (auto it = g_morphIds.find(morphKey); it != g_morphIds.end()) {
+            return it->second;
+        }
 
-                task->AddTask([actor, morphNameCopy, valueToApply]() {
-                    auto aa = actor.get();
-                    if (!aa) {
-                        return;
-                    }
-                    // No logging here to avoid spam  this is just keeping the value alive / tweened.
-                    Papyrus_FBSetMorph(aa.get(), morphNameCopy.c_str(), valueToApply, false);
-                    });
-            }
+        const auto count = g_morphCount.load(std::memory_order_relaxed);
+        if (count >= kMaxMorphs) {
+            spdlog::warn("[FB] Morph: more than {} distinct morphs; '{}' ignored", kMaxMorphs, morphKey);
+            return kInvalidMorphId;
+        }
 
-            // Mark not running and clean up entry if its still current
-            entry->running.store(false);
+        auto& info = g_morphTable[count];
+        info.logicalKey.assign(morphKey);
+        info.rmMorphName = RE::BSFixedString(ResolveRaceMenuMorphName(info.logicalKey));
 
-            {
-                std::lock_guard _{ g_mutex };
-                auto itA = g_sticky.find(formID);
-                if (itA != g_sticky.end()) {
-                    auto itK = itA->second.find(entry->logicalKey);
-                    if (itK != itA->second.end() && itK->second.get() == entry.get()) {
-                        itA->second.erase(itK);
-                        if (itA->second.empty()) {
-                            g_sticky.erase(itA);
-                        }
-                    }
-                }
-            }
+        const auto id = static_cast<MorphId>(count);
+        g_morphIds.emplace(info.logicalKey, id);
+        g_morphCount.store(count + 1, std::memory_order_release);
+        return id;
+    }
 
-            if (logOps) {
-                spdlog::info(
-                    "[FB] Morph: Sticky end actorFormID={} morph='{}'",
-                    formID,
-                    entry->logicalKey);
-            }
-            }).detach();
+    std::string_view MorphName(MorphId morph)
+    {
+        if (morph >= g_morphCount.load(std::memory_order_acquire)) {
+            return {};
+        }
+        return g_morphTable[morph].logicalKey;
     }
-}  // namespace
 
-namespace FB::Morph
-{
-    void FB::Morph::AddDelta(RE::ActorHandle actor, std::string_view morphKey, float delta, bool logOps)
+    void AddDelta(RE::ActorHandle actor, MorphId morph, float delta, bool logOps)
     {
         auto a = actor.get();
         if (!a) {
             return;
         }
 
-        const char* morphName = ResolveRaceMenuMorphName(morphKey);
-        if (!morphName || morphName[0] == '\0') {
+        if (morph >= g_morphCount.load(std::memory_order_acquire)) {
             if (logOps) {
-                spdlog::warn("[FB] Morph: unknown MorphKey '{}'", std::string(morphKey));
+                spdlog::warn("[FB] Morph: unknown MorphId {}", morph);
             }
             return;
         }
 
         float newValue = 0.0f;
         const std::uint32_t formID = a->GetFormID();
-        const std::string keyStr = std::string(morphKey);
+        const auto actorSlot = FB::ActorRegistry::Acquire(formID);
+        if (!actorSlot.Valid()) {
+            return;  // registry full (logged once there)
+        }
 
         {
             std::lock_guard _{ g_mutex };
 
-            const auto now = Clock::now();
+            const auto now = FB::FrameClock::Now();
 
-            // Canonical logical values for this actor+morph
-            auto& slot = g_values[formID][keyStr];
-            const float prevValue = slot;         // value BEFORE this delta
-            slot = Clamp(slot + delta);           // value AFTER this delta
-            newValue = slot;
+            // Canonical logical value for this actor+morph (first use of a morph on an actor grows its slots)
+            auto& slots = GetActorLocked(actorSlot, formID).slots;
+            if (morph >= slots.size()) {
+                slots.resize(static_cast<std::size_t>(morph) + 1);
+            }
+            auto& slot = slots[morph];
+            const float prevValue = slot.value;       // value BEFORE this delta
+            slot.value = Clamp(slot.value + delta);   // value AFTER this delta
+            newValue = slot.value;
 
             // Get/create sticky tween entry
-            auto& byKey = g_sticky[formID];
-            auto& entry = byKey[keyStr];
-            if (!entry) {
-                entry = std::make_shared<StickyEntry>();
-                entry->logicalKey = keyStr;
-                entry->rmMorphName = morphName;
+            StickyEntry* entry = nullptr;
+            if (slot.sticky != kNoSticky) {
+                entry = std::addressof(g_sticky[slot.sticky]);
+            }
+            else {
+                slot.sticky = static_cast<std::uint32_t>(g_sticky.size());
+                entry = std::addressof(g_sticky.emplace_back());
+                entry->actor = actor;
+                entry->formID = formID;
+                entry->actorSlot = actorSlot;
+                entry->morph = morph;
                 entry->intervalSeconds = 0.05f;   // 20 Hz
                 entry->value = prevValue;         // start from previous logical value, not 0
             }
+            entry->logOps = logOps;
 
             // Start (or restart) tween from prevValue -> newValue
             entry->fromValue = prevValue;
             entry->toValue = newValue;
             entry->startTime = now;
-            entry->endTime = now + std::chrono::milliseconds(400);  // 0.4s tween
+            entry->endTime = now + kStickyTweenTicks;
             entry->tweenActive = true;
 
             // Extend hold window so tween + a bit of idle time are covered
-            const auto minHold = entry->endTime + std::chrono::milliseconds(850);
+            const auto minHold = entry->endTime + kStickyIdleTicks;
             if (entry->holdUntil < minHold) {
                 entry->holdUntil = minHold;
             }
         }
 
-        if (logOps) {
+        if (logOps && FB::Log::Allow(FB::Log::Category::kMorphOp)) {
             spdlog::info(
                 "[FB] Morph: AddDelta actor='{}' morph='{}' delta={} -> value={}",
                 a->GetName(),
-                morphName,
+                g_morphTable[morph].rmMorphName.c_str(),
                 delta,
                 newValue);
         }
+    }
 
-        // Ensure the sticky worker is running for this actor+morph
-        std::shared_ptr<StickyEntry> entryCopy;
-        {
-            std::lock_guard _{ g_mutex };
-            auto itA = g_sticky.find(formID);
-            if (itA != g_sticky.end()) {
-                auto itK = itA->second.find(keyStr);
-                if (itK != itA->second.end()) {
-                    entryCopy = itK->second;
+    void UpdateSticky()
+    {
+        std::lock_guard _{ g_mutex };
+
+        if (g_sticky.empty()) {
+            return;
+        }
+
+        const auto now = FB::FrameClock::Now();
+
+        // Effect LOD on visible work first. Culled actors get no re-applies: only a finished tween's
+        // final value, marked here and written below while budget lasts (a skipped one stays due).
+        // An actor back in view gets the then-current value on its next re-apply.
+        const auto farTicks = FB::FrameClock::FromSeconds(FB::Scheduler::FarUpdateInterval());
+        for (std::size_t i = 0; i < g_sticky.size(); ) {
+            auto& entry = g_sticky[i];
+
+            auto lod = FB::Scheduler::Lod::kNear;
+            if (now <= entry.holdUntil && now >= entry.nextApply) {
+                lod = FB::Scheduler::GetLod(entry.actor.get().get());
+            }
+
+            if (lod == FB::Scheduler::Lod::kCulled) {
+                if (entry.tweenActive && now >= entry.endTime) {
+                    entry.finalDue = true;
                 }
+                else {
+                    entry.nextApply = now + FB::FrameClock::FromSeconds(std::max(0.01f, entry.intervalSeconds));
+                }
+                ++i;
+                continue;
             }
+
+            if (TickStickyLocked(entry, now)) {
+                if (lod == FB::Scheduler::Lod::kFar) {
+                    entry.nextApply = std::max(entry.nextApply, now + farTicks);
+                }
+                ++i;
+                continue;
+            }
+
+            if (entry.logOps) {
+                spdlog::info(
+                    "[FB] Morph: Sticky end actorFormID={} morph='{}'",
+                    entry.formID,
+                    MorphName(entry.morph));
+            }
+
+            // Swap-remove; order of sticky entries is irrelevant
+            RemoveStickyLocked(i);
         }
-        if (entryCopy) {
-            EnsureStickyWorker(actor, formID, entryCopy, logOps);
+
+        std::size_t deferred = 0;
+        for (auto& entry : g_sticky) {
+            if (!entry.finalDue) {
+                continue;
+            }
+
+            entry.finalDue = false;
+            if (FB::Scheduler::HasBudget()) {
+                (void)TickStickyLocked(entry, now);
+            }
+            else {
+                ++deferred;
+            }
         }
-    }
 
+        FB_STATS_ADD(kDeferredSticky, deferred);
+    }
 
     void ResetAllForActor(RE::ActorHandle actor, bool logOps)
     {
@@ -369,18 +518,23 @@ namespace FB::Morph
 
         {
             std::lock_guard _{ g_mutex };
-            g_values.erase(formID);
-            g_sticky.erase(formID);  // workers will naturally exit once holdUntil passes
-        }
-
-        if (auto* task = SKSE::GetTaskInterface()) {
-            task->AddTask([actor, logOps]() {
-                auto aa = actor.get();
-                if (!aa) {
-                    return;
+            DropActorLocked(formID);
+
+            // The clear goes out with the next flush, ahead of any write queued for the actor after this
+            // (a cancel followed by a restart in the same tick keeps the restart's values).
+            auto& pending = GetPendingLocked(actor, formID);
+            pending.clear = true;
+            pending.logOps |= logOps;
+
+            // Keep the slots (no reallocation on the next use); just zero the values
+            if (const auto actorSlot = FB::ActorRegistry::Find(formID); actorSlot.Valid()) {
+                auto& entry = g_actors[actorSlot.index];
+                if (entry.generation == actorSlot.generation) {
+                    for (auto& slot : entry.slots) {
+                        slot.value = 0.0f;
+                    }
                 }
-                Papyrus_FBClearMorphs(aa.get(), logOps);
-                });
+            }
         }
 
         if (logOps) {
@@ -390,4 +544,90 @@ namespace FB::Morph
                 FB::Morph::kMorphKey);
         }
     }
+
+    void FlushPending()
+    {
+        // One bridge call (and one UpdateModelWeight) per actor, regardless of how many sliders changed.
+        // The name/value arrays are built under the lock; the native call or Papyrus dispatch happens outside it.
+        for (std::size_t i = 0;; ++i) {
+            RE::ActorHandle actor;
+            bool logOps = false;
+            bool clear = false;
+            auto& names = g_flushNames;
+            auto& values = g_flushValues;
+
+            {
+                std::lock_guard _{ g_mutex };
+                if (i >= g_pending.size()) {
+                    break;
+                }
+
+                auto& p = g_pending[i];
+                if (p.formID == 0 || (p.count == 0 && !p.clear)) {
+                    continue;
+                }
+
+                actor = p.actor;
+                logOps = p.logOps;
+                clear = p.clear;
+                names.clear();
+                values.clear();
+                for (std::size_t w = 0; w < p.count; ++w) {
+                    names.push_back(g_morphTable[p.writes[w].morph].rmMorphName);
+                    values.push_back(p.writes[w].value);
+                }
+
+                // Recycle the slot (keeps write capacity)
+                p.formID = 0;
+                p.count = 0;
+                p.logOps = false;
+                p.clear = false;
+            }
+
+            auto a = actor.get();
+            if (!a) {
+                continue;
+            }
+
+            // Clear first, then this tick's writes: both go out in order through the same path
+            if (clear) {
+                ClearMorphs(a.get(), logOps);
+            }
+            if (!names.empty()) {
+                WriteMorphs(a.get(), names, values, logOps);
+            }
+        }
+    }
+
+    void ForgetActor(FB::ActorRegistry::Slot actorSlot)
+    {
+        if (!actorSlot.Valid()) {
+            return;
+        }
+
+        std::lock_guard _{ g_mutex };
+        auto& entry = g_actors[actorSlot.index];
+        if (entry.generation != actorSlot.generation) {
+            return;
+        }
+
+        DropActorLocked(entry.formID);
+        entry = {};  // releases the slot vector
+    }
+
+    void ForgetAll()
+    {
+        std::lock_guard _{ g_mutex };
+        g_sticky.clear();
+        for (auto& p : g_pending) {
+            p.formID = 0;
+            p.count = 0;
+            p.logOps = false;
+            p.clear = false;
+        }
+        for (auto& entry : g_actors) {
+            entry = {};
+        }
+    }
+
 }
@@ -2,6 +2,8 @@
 
 #include "RE/Skyrim.h"
 
+#include "FBActorRegistry.h"
+
 #include <cstdint>
 #include <string_view>
 
@@ -18,17 +20,58 @@ namespace FB::Morph
 	inline constexpr float kMinValue = 0.0f;
 	inline constexpr float kMaxValue = 100.0f;
 
-	// Add delta to this plugin's current value for (actor, morphKey).
+	// Compact handle for a morph, interned once (FBConfig does this at load) and valid for the process
+	// lifetime. Per-actor morph state is a dense array indexed by it.
+	using MorphId = std::uint16_t;
+	inline constexpr MorphId kInvalidMorphId = 0xFFFF;
+
+	// Intern a logical morph key: resolves its RaceMenu morph name and pools it as a BSFixedString.
+	// Returns the existing ID for a known key; kInvalidMorphId if the key is empty or the table is full.
+	// Thread-safe.
+	MorphId InternMorph(std::string_view morphKey);
+
+	// Logical key for an interned ID (empty for kInvalidMorphId). Lock-free; for logging.
+	std::string_view MorphName(MorphId morph);
+
+	// Add delta to this plugin's current value for (actor, morph).
 	// Also enables "sticky" re-apply for a short window so the value doesn't get overwritten between timeline ticks.
 	void AddDelta(
 		RE::ActorHandle actor,
-		std::string_view morphKey,
+		MorphId morph,
 		float delta,
 		bool logOps);
 
 	// Clear all morphs applied by this plugin (by key) for actor.
-	// Also stops any sticky re-apply loops for that actor.
+	// Also drops the actor's sticky entries and any queued writes. The clear itself goes out with the
+	// next FlushPending, before any write queued for the actor after this call.
 	void ResetAllForActor(
 		RE::ActorHandle actor,
 		bool logOps);
+
+	// Drop an actor's per-morph state and queued writes (its 3D unloaded). Leaves applied morphs alone.
+	void ForgetActor(FB::ActorRegistry::Slot actorSlot);
+
+	// ForgetActor for every actor at once (new game / save loaded: every slot is about to be reclaimed).
+	void ForgetAll();
+
+	// Advance every sticky entry (hold window + 0.4s ease tween) and queue due re-applies.
+	// Single game-thread scheduler driven by the update pump; no worker threads.
+	// Effect LOD (FB::Scheduler::GetLod): far actors re-apply at the far rate, culled ones not at all
+	// except for a finished tween's final value, which waits for frame budget.
+	void UpdateSticky();
+
+	// Flush all morph writes queued since the last call (sticky re-applies / tween steps).
+	// Writes go straight to RaceMenu's native body-morph interface when it is available (see
+	// RequestNativeInterface), else one FBMorphBridge.FBSetMorphs call per actor. Either way
+	// UpdateModelWeight runs once per actor. The call is logged (MorphBridgeCall, rate-limited) for
+	// actors that had a write queued by an AddDelta with logOps.
+	// Must be called on the game thread (ActorManager::Update does this at the end of each tick).
+	void FlushPending();
+
+	// Ask RaceMenu (skee) for its IBodyMorphInterface over SKSE messaging. Call once at kPostPostLoad.
+	// Without it (RaceMenu missing or too old) every write keeps going through the Papyrus bridge.
+	void RequestNativeInterface();
+
+	// [General] NativeMorphs: false forces the Papyrus bridge even when the native interface exists.
+	void SetNativeEnabled(bool enabled);
 }
@@ -0,0 +1,211 @@
+#include "FBMorphWriter.h"
+#include "FBMorph.h"
+#include "FBLog.h"
+#include "FBStats.h"
+#include "SKEEInterface.h"
+
+#include "RE/F/FunctionArguments.h"
+#include "RE/S/SkyrimVM.h"
+#include "SKSE/SKSE.h"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+    // RaceMenu's native body-morph interface (null until RequestNativeInterface succeeds)
+    std::atomic<SKEE::IBodyMorphInterface*> g_bodyMorph{ nullptr };
+    std::atomic_bool g_nativeEnabled{ true };
+
+    // Null when the native path is unavailable or disabled; callers then use the Papyrus bridge.
+    static SKEE::IBodyMorphInterface* GetNativeBodyMorph()
+    {
+        if (!g_nativeEnabled.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return g_bodyMorph.load(std::memory_order_acquire);
+    }
+
+    static RE::BSScript::IVirtualMachine* GetVM()
+    {
+        auto* skyrimVM = RE::SkyrimVM::GetSingleton();
+        return skyrimVM ? skyrimVM->impl.get() : nullptr;
+    }
+
+    //
+    // Bridge helpers - call into FBMorphBridge.psc, which talks to NiOverride.
+    //
+    // Papyrus side:
+    //   Function FBSetMorphs(Actor akActor, String[] morphNames, Float[] values) Global
+    //   Function FBClearMorphs(Actor akActor) Global
+    //
+
+    static void Papyrus_FBSetMorphs(
+        RE::Actor* actor,
+        std::vector<RE::BSFixedString> morphNames,
+        std::vector<float> values,
+        bool logOps)
+    {
+        if (!actor || morphNames.empty() || morphNames.size() != values.size()) {
+            return;
+        }
+
+        auto* vm = GetVM();
+        if (!vm) {
+            if (logOps) {
+                spdlog::warn("[FB] Morph: SkyrimVM/IVirtualMachine not available");
+            }
+            return;
+        }
+
+        RE::BSTSmartPointer<RE::BSScript::IStackCallbackFunctor> result{};
+
+        const std::size_t count = morphNames.size();
+
+        // FBMorphBridge.FBSetMorphs(Actor akActor, String[] morphNames, Float[] values)
+        auto* args = RE::MakeFunctionArguments(
+            static_cast<RE::Actor*>(actor),
+            std::move(morphNames),
+            std::move(values));
+
+        static const RE::BSFixedString kBridgeClass{ "FBMorphBridge" };
+        static const RE::BSFixedString kSetMorphs{ "FBSetMorphs" };
+
+        FB_STATS_ADD(kPapyrusDispatches, 1);
+        const bool ok = vm->DispatchStaticCall(kBridgeClass, kSetMorphs, args, result);
+
+        if (logOps && FB::Log::Allow(FB::Log::Category::kMorphBridgeCall)) {
+            spdlog::info("[FB] MorphBridgeCall: FBSetMorphs={} actor='{}' count={}", ok, actor->GetName(), count);
+        }
+    }
+
+    static void Papyrus_FBClearMorphs(RE::Actor* actor, bool logOps)
+    {
+        if (!actor) {
+            return;
+        }
+
+        auto* vm = GetVM();
+        if (!vm) {
+            if (logOps) {
+                spdlog::warn("[FB] Morph: SkyrimVM/IVirtualMachine not available");
+            }
+            return;
+        }
+
+        RE::BSTSmartPointer<RE::BSScript::IStackCallbackFunctor> result{};
+
+        // FBMorphBridge.FBClearMorphs(Actor akActor)
+        auto* args = RE::MakeFunctionArguments(
+            static_cast<RE::Actor*>(actor));
+
+        static const RE::BSFixedString kBridgeClass{ "FBMorphBridge" };
+        static const RE::BSFixedString kClearMorphs{ "FBClearMorphs" };
+
+        FB_STATS_ADD(kPapyrusDispatches, 1);
+        const bool ok = vm->DispatchStaticCall(kBridgeClass, kClearMorphs, args, result);
+
+        if (logOps && FB::Log::Allow(FB::Log::Category::kMorphBridgeCall)) {
+            spdlog::info("[FB] MorphBridgeCall: FBClearMorphs={} key='{}'", ok, FB::Morph::kMorphKey);
+        }
+    }
+
+    //
+    // Native helpers  same operations as FBMorphBridge.psc, called directly on RaceMenu's interface.
+    // Game thread only; no VM scheduling.
+    //
+
+    static void Native_SetMorphs(
+        SKEE::IBodyMorphInterface& bodyMorph,
+        RE::Actor* actor,
+        const std::vector<RE::BSFixedString>& morphNames,
+        const std::vector<float>& values,
+        bool logOps)
+    {
+        if (!actor || morphNames.empty() || morphNames.size() != values.size()) {
+            return;
+        }
+
+        const char* key = FB::Morph::kMorphKey.data();
+        for (std::size_t i = 0; i < morphNames.size(); ++i) {
+            bodyMorph.SetMorph(actor, morphNames[i].c_str(), key, values[i]);
+        }
+        bodyMorph.UpdateModelWeight(actor, false);
+
+        if (logOps && FB::Log::Allow(FB::Log::Category::kMorphBridgeCall)) {
+            spdlog::info("[FB] MorphBridgeCall: native SetMorphs actor='{}' count={}", actor->GetName(), morphNames.size());
+        }
+    }
+
+    static void Native_ClearMorphs(SKEE::IBodyMorphInterface& bodyMorph, RE::Actor* actor, bool logOps)
+    {
+        if (!actor) {
+            return;
+        }
+
+        bodyMorph.ClearBodyMorphKeys(actor, FB::Morph::kMorphKey.data());
+        bodyMorph.UpdateModelWeight(actor, false);
+
+        if (logOps && FB::Log::Allow(FB::Log::Category::kMorphBridgeCall)) {
+            spdlog::info("[FB] MorphBridgeCall: native ClearMorphs key='{}'", FB::Morph::kMorphKey);
+        }
+    }
+}
+
+namespace FB::Morph
+{
+    void WriteMorphs(
+        RE::Actor* actor,
+        const std::vector<RE::BSFixedString>& morphNames,
+        const std::vector<float>& values,
+        bool logOps)
+    {
+        if (auto* bodyMorph = GetNativeBodyMorph()) {
+            Native_SetMorphs(*bodyMorph, actor, morphNames, values, logOps);
+        }
+        else {
+            Papyrus_FBSetMorphs(actor, morphNames, values, logOps);  // copies: the VM call owns its arrays
+        }
+    }
+
+    void ClearMorphs(RE::Actor* actor, bool logOps)
+    {
+        if (auto* bodyMorph = GetNativeBodyMorph()) {
+            Native_ClearMorphs(*bodyMorph, actor, logOps);
+        }
+        else {
+            Papyrus_FBClearMorphs(actor, logOps);
+        }
+    }
+
+    void RequestNativeInterface()
+    {
+        auto* messaging = SKSE::GetMessagingInterface();
+        if (!messaging) {
+            return;
+        }
+
+        SKEE::InterfaceExchangeMessage msg{};
+        messaging->Dispatch(SKEE::InterfaceExchangeMessage::kExchangeInterface, &msg, sizeof(msg), "skee");
+        if (!msg.interfaceMap) {
+            spdlog::info("[FB] Morph: RaceMenu interface map not available; using FBMorphBridge (Papyrus)");
+            return;
+        }
+
+        auto* bodyMorph = static_cast<SKEE::IBodyMorphInterface*>(msg.interfaceMap->QueryInterface("BodyMorph"));
+        if (!bodyMorph) {
+            spdlog::info("[FB] Morph: RaceMenu BodyMorph interface not available; using FBMorphBridge (Papyrus)");
+            return;
+        }
+
+        g_bodyMorph.store(bodyMorph, std::memory_order_release);
+        spdlog::info("[FB] Morph: using RaceMenu BodyMorph interface v{} (native)", bodyMorph->GetVersion());
+    }
+
+    void SetNativeEnabled(bool enabled)
+    {
+        g_nativeEnabled.store(enabled, std::memory_order_relaxed);
+    }
+}
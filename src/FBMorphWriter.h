@@ -0,0 +1,22 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <vector>
+
+namespace FB::Morph
+{
+	// Engine side of FlushPending (FBMorphWriter.cpp): RaceMenu's native BodyMorph interface when it
+	// is available and enabled, else the FBMorphBridge Papyrus bridge. Game thread.
+	// FBMorph.cpp (values, sticky scheduler, per-actor batching) reaches the game only through these.
+
+	// Set morphNames[i] = values[i] under kMorphKey, then one UpdateModelWeight.
+	void WriteMorphs(
+		RE::Actor* actor,
+		const std::vector<RE::BSFixedString>& morphNames,
+		const std::vector<float>& values,
+		bool logOps);
+
+	// Clear every morph this plugin set (by kMorphKey), then one UpdateModelWeight.
+	void ClearMorphs(RE::Actor* actor, bool logOps);
+}
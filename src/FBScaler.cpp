@@ -1,15 +1,131 @@
 #include "FBScaler.h"
+#include "FBLog.h"
+#include "FBStats.h"
 
 #include "SKSE/SKSE.h"
 #include "RE/Skyrim.h"
 
 #include <algorithm>
+#include <bit>
 #include <string>
+#include <unordered_map>
+
+namespace
+{
+	// Resolved node pointers for one actor's current 3D instance.
+	// Game thread only: every access happens inside an AddTask callback.
+	struct NodeCache
+	{
+		// Identity of the 3D root the slots were resolved against; a different root means the 3D was reloaded.
+		RE::NiPointer<RE::NiAVObject> root;
+
+		std::array<RE::NiPointer<RE::NiAVObject>, FB::Scaler::kNodeCount> nodes{};
+
+		// Bit i set => slot i has been looked up (nodes[i] may still be null if the skeleton lacks it).
+		std::uint32_t resolvedMask{ 0 };
+	};
+
+	static_assert(FB::Scaler::kNodeCount <= 32, "NodeCache::resolvedMask holds one bit per NodeId");
+
+	std::unordered_map<std::uint32_t, NodeCache> g_nodeCache;
+
+	static RE::NiAVObject* ResolveCachedNode(RE::Actor* a, RE::NiAVObject* root, FB::Scaler::NodeId id)
+	{
+		auto& cache = g_nodeCache[a->GetFormID()];
+
+		if (cache.root.get() != root) {
+			cache.root = RE::NiPointer<RE::NiAVObject>(root);
+			cache.nodes.fill(RE::NiPointer<RE::NiAVObject>{});
+			cache.resolvedMask = 0;
+		}
+
+		const auto idx = static_cast<std::size_t>(id);
+		const std::uint32_t bit = 1u << idx;
+
+		if ((cache.resolvedMask & bit) == 0) {
+			const std::string_view name = FB::Scaler::GetNodeName(id);
+			cache.nodes[idx] = RE::NiPointer<RE::NiAVObject>(root->GetObjectByName(name.data()));
+			cache.resolvedMask |= bit;
+		}
+
+		return cache.nodes[idx].get();
+	}
+
+	static void ApplyScale(RE::Actor* a, RE::NiAVObject* obj, std::string_view nodeName, float scale, bool logOps)
+	{
+		if (!obj) {
+			if (logOps && FB::Log::Allow(FB::Log::Category::kNodeScale)) {
+				spdlog::info("[FB] NodeScale: node '{}' not found for '{}'", nodeName, a->GetName());
+			}
+			return;
+		}
+
+		if (logOps && FB::Log::Allow(FB::Log::Category::kNodeScale)) {
+			spdlog::info("[FB] NodeScale: actor='{}' node='{}' oldScale={} newScale={}",
+				a->GetName(),
+				obj->name.c_str(),
+				obj->local.scale,
+				scale);
+		}
+
+		obj->local.scale = scale;
+	}
+
+	static void ApplyWrites(const FB::Scaler::Batch::ActorWrites& w)
+	{
+		auto a = w.actor.get();
+		if (!a) {
+			return;
+		}
+
+		auto root = a->Get3D();
+		if (!root) {
+			return;
+		}
+
+		for (auto bits = w.mask; bits != 0; bits &= bits - 1) {
+			const auto id = static_cast<FB::Scaler::NodeId>(std::countr_zero(bits));
+			const float scale = w.scales[static_cast<std::size_t>(id)];
+			ApplyScale(a.get(), ResolveCachedNode(a.get(), root, id), FB::Scaler::GetNodeName(id), scale, w.logOps);
+		}
+	}
+}
 
 namespace FB::Scaler
 {
+	void SetNodeScale(RE::ActorHandle actor, NodeId id, float scale, bool logOps)
+	{
+		// Clamp here so every caller benefits and we keep behavior consistent.
+		scale = std::clamp(scale, 0.0f, 5.0f);
+
+		auto* task = SKSE::GetTaskInterface();
+		if (!task) {
+			return;
+		}
+
+		FB_STATS_ADD(kScaleTasks, 1);
+		task->AddTask([actor, id, scale, logOps]() {
+			auto a = actor.get();
+			if (!a) {
+				return;
+			}
+
+			auto root = a->Get3D();
+			if (!root) {
+				return;
+			}
+
+			ApplyScale(a.get(), ResolveCachedNode(a.get(), root, id), GetNodeName(id), scale, logOps);
+			});
+	}
+
 	void SetNodeScale(RE::ActorHandle actor, std::string_view nodeName, float scale, bool logOps)
 	{
+		if (const auto id = FindNodeId(nodeName)) {
+			SetNodeScale(actor, *id, scale, logOps);
+			return;
+		}
+
 		// Clamp here so every caller benefits and we keep behavior consistent.
 		scale = std::clamp(scale, 0.0f, 5.0f);
 
@@ -21,6 +137,7 @@ namespace FB::Scaler
 		// Copy nodeName into owned string because we hop threads.
 		const std::string node{ nodeName };
 
+		FB_STATS_ADD(kScaleTasks, 1);
 		task->AddTask([actor, node, scale, logOps]() {
 			auto a = actor.get();
 			if (!a) {
@@ -32,23 +149,50 @@ namespace FB::Scaler
 				return;
 			}
 
-			auto obj = root->GetObjectByName(node.c_str());
-			if (!obj) {
-				if (logOps) {
-					spdlog::info("[FB] NodeScale: node '{}' not found for '{}'", node, a->GetName());
-				}
-				return;
-			}
+			ApplyScale(a.get(), root->GetObjectByName(node.c_str()), node, scale, logOps);
+			});
+	}
 
-			if (logOps) {
-				spdlog::info("[FB] NodeScale: actor='{}' node='{}' oldScale={} newScale={}",
-					a->GetName(),
-					obj->name.c_str(),
-					obj->local.scale,
-					scale);
-			}
+	void PostBatchWrites(const Batch::ActorWrites& writes)
+	{
+		auto* task = SKSE::GetTaskInterface();
+		if (!task) {
+			return;
+		}
+
+		FB_STATS_ADD(kScaleTasks, 1);
+		task->AddTask([w = writes]() {
+			ApplyWrites(w);
+			});
+	}
+
+	std::optional<float> GetNodeScale(RE::ActorHandle actor, NodeId id)
+	{
+		auto a = actor.get();
+		if (!a) {
+			return std::nullopt;
+		}
+
+		auto root = a->Get3D();
+		if (!root) {
+			return std::nullopt;
+		}
+
+		if (auto* obj = ResolveCachedNode(a.get(), root, id)) {
+			return obj->local.scale;
+		}
+		return std::nullopt;
+	}
+
+	void InvalidateNodeCache(std::uint32_t actorFormID)
+	{
+		auto* task = SKSE::GetTaskInterface();
+		if (!task) {
+			return;
+		}
 
-			obj->local.scale = scale;
+		task->AddTask([actorFormID]() {
+			g_nodeCache.erase(actorFormID);
 			});
 	}
 
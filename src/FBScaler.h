@@ -2,8 +2,14 @@
 
 #include "RE/Skyrim.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 namespace FB::Scaler
 {
@@ -12,6 +18,7 @@ namespace FB::Scaler
 	// -------------------------
 	// Scales a single node by name on the actor's 3D (thread-safe via SKSE task queue).
 	// Returns immediately; work is executed on the game thread.
+	// Names from the kNode* table go through the per-actor node cache; others fall back to GetObjectByName.
 	void SetNodeScale(RE::ActorHandle actor, std::string_view nodeName, float scale, bool logOps);
 
 	// Convenience: reset one or more nodes to scale=1.0f.
@@ -49,112 +56,301 @@ namespace FB::Scaler
 	inline constexpr std::string_view kNodeLToe0 = "NPC L Toe0 [LToe]";
 	inline constexpr std::string_view kNodeRToe0 = "NPC R Toe0 [RToe]";
 
+	// -------------------------
+	// Compact node IDs
+	// -------------------------
+	// Index into kNodeNames; the per-actor node cache is a flat array in this order.
+	enum class NodeId : std::uint8_t
+	{
+		kHead,
+		kNeck,
+
+		kSpine0,
+		kSpine1,
+		kSpine2,
+		kSpine3,
+
+		kPelvis,
+
+		kLClavicle,
+		kRClavicle,
+		kLUpperArm,
+		kRUpperArm,
+		kLForearm,
+		kRForearm,
+		kLHand,
+		kRHand,
+
+		kLThigh,
+		kRThigh,
+		kLCalf,
+		kRCalf,
+		kLFoot,
+		kRFoot,
+		kLToe0,
+		kRToe0,
+
+		kCount
+	};
+
+	inline constexpr std::size_t kNodeCount = static_cast<std::size_t>(NodeId::kCount);
+
+	inline constexpr std::array<std::string_view, kNodeCount> kNodeNames{
+		kNodeHead,
+		kNodeNeck,
+
+		kNodeSpine0,
+		kNodeSpine1,
+		kNodeSpine2,
+		kNodeSpine3,
+
+		kNodePelvis,
+
+		kNodeLClavicle,
+		kNodeRClavicle,
+		kNodeLUpperArm,
+		kNodeRUpperArm,
+		kNodeLForearm,
+		kNodeRForearm,
+		kNodeLHand,
+		kNodeRHand,
+
+		kNodeLThigh,
+		kNodeRThigh,
+		kNodeLCalf,
+		kNodeRCalf,
+		kNodeLFoot,
+		kNodeRFoot,
+		kNodeLToe0,
+		kNodeRToe0,
+	};
+
+	inline constexpr std::string_view GetNodeName(NodeId id)
+	{
+		return kNodeNames[static_cast<std::size_t>(id)];
+	}
+
+	// Canonical node name -> NodeId (nullopt for names outside the table).
+	inline constexpr std::optional<NodeId> FindNodeId(std::string_view nodeName)
+	{
+		for (std::size_t i = 0; i < kNodeCount; ++i) {
+			if (kNodeNames[i] == nodeName) {
+				return static_cast<NodeId>(i);
+			}
+		}
+		return std::nullopt;
+	}
+
+	// Author-facing NodeKey -> NodeId mapping (the INI's node keys; the config's NodeKeyResolver).
+	// Keep these keys stable; they are part of the INI "public API".
+	// Sorted by key (ordinal) so ResolveNodeKey is a constexpr binary search.
+	struct NodeKeyEntry
+	{
+		std::string_view key;
+		NodeId node;
+	};
+
+	inline constexpr std::array kNodeKeys{
+		NodeKeyEntry{ "Head", NodeId::kHead },
+		NodeKeyEntry{ "LCalf", NodeId::kLCalf },
+		NodeKeyEntry{ "LClavicle", NodeId::kLClavicle },
+		NodeKeyEntry{ "LFoot", NodeId::kLFoot },
+		NodeKeyEntry{ "LForearm", NodeId::kLForearm },
+		NodeKeyEntry{ "LHand", NodeId::kLHand },
+		NodeKeyEntry{ "LThigh", NodeId::kLThigh },
+		NodeKeyEntry{ "LToe0", NodeId::kLToe0 },
+		NodeKeyEntry{ "LUpperArm", NodeId::kLUpperArm },
+		NodeKeyEntry{ "Neck", NodeId::kNeck },
+		NodeKeyEntry{ "Pelvis", NodeId::kPelvis },
+		NodeKeyEntry{ "RCalf", NodeId::kRCalf },
+		NodeKeyEntry{ "RClavicle", NodeId::kRClavicle },
+		NodeKeyEntry{ "RFoot", NodeId::kRFoot },
+		NodeKeyEntry{ "RForearm", NodeId::kRForearm },
+		NodeKeyEntry{ "RHand", NodeId::kRHand },
+		NodeKeyEntry{ "RThigh", NodeId::kRThigh },
+		NodeKeyEntry{ "RToe0", NodeId::kRToe0 },
+		NodeKeyEntry{ "RUpperArm", NodeId::kRUpperArm },
+		NodeKeyEntry{ "Spine", NodeId::kSpine0 },  // Legacy convenience key
+		NodeKeyEntry{ "Spine0", NodeId::kSpine0 },
+		NodeKeyEntry{ "Spine1", NodeId::kSpine1 },
+		NodeKeyEntry{ "Spine2", NodeId::kSpine2 },
+		NodeKeyEntry{ "Spine3", NodeId::kSpine3 },
+	};
+
+	static_assert(std::ranges::is_sorted(kNodeKeys, {}, &NodeKeyEntry::key), "kNodeKeys must stay sorted by key");
+
+	inline constexpr std::optional<NodeId> ResolveNodeKey(std::string_view key)
+	{
+		const auto it = std::ranges::lower_bound(kNodeKeys, key, {}, &NodeKeyEntry::key);
+		if (it != kNodeKeys.end() && it->key == key) {
+			return it->node;
+		}
+		return std::nullopt;
+	}
+
+	static_assert(ResolveNodeKey("Head") == NodeId::kHead);
+	static_assert(ResolveNodeKey("Spine") == NodeId::kSpine0);
+	static_assert(!ResolveNodeKey("head"));
+
+	// Cached variant of SetNodeScale: the NiAVObject* for (actor, id) is resolved once per 3D instance.
+	void SetNodeScale(RE::ActorHandle actor, NodeId id, float scale, bool logOps);
+
+	// -------------------------
+	// Batched writes
+	// -------------------------
+	// Collects scale writes for any number of actors and applies them with one SKSE task per actor:
+	// one handle resolve and one 3D root lookup per actor per flush, last write per node wins.
+	// Not thread-safe; each owner (e.g. the ActorManager tick) keeps its own instance.
+	class Batch
+	{
+	public:
+		void Set(RE::ActorHandle actor, NodeId id, float scale, bool logOps);
+
+		// Queue scale=1.0f for every node whose bit (1u << NodeId) is set in nodeMask.
+		void ResetMask(RE::ActorHandle actor, std::uint32_t nodeMask, bool logOps);
+
+		// Value queued for (actor, id) since the last Flush, if any.
+		std::optional<float> Peek(RE::ActorHandle actor, NodeId id) const;
+
+		// Post the queued writes and clear the batch (storage is kept for reuse).
+		void Flush();
+
+		bool Empty() const { return count == 0; }
+
+		struct ActorWrites
+		{
+			RE::ActorHandle actor;
+			std::uint32_t mask{ 0 };
+			std::array<float, kNodeCount> scales{};
+			bool logOps{ false };
+		};
+
+	private:
+		ActorWrites& GetOrAdd(RE::ActorHandle actor);
+
+		// Only [0, count) is live
+		std::vector<ActorWrites> pending;
+		std::size_t count{ 0 };
+	};
+
+	// Engine side of Batch::Flush, called once per actor with queued writes: posts them as one SKSE
+	// task (FBScaler.cpp). Batch itself lives in FBScalerBatch.cpp and never touches the engine.
+	void PostBatchWrites(const Batch::ActorWrites& writes);
+
+	// Current local scale of a cached node (nullopt if the actor, its 3D or the node is missing).
+	// Game thread only: reads the same node cache the batched writes use.
+	std::optional<float> GetNodeScale(RE::ActorHandle actor, NodeId id);
+
+	// Drop the cached node pointers for an actor (e.g. when its 3D is unloaded).
+	// A changed 3D root is also detected automatically on the next write.
+	void InvalidateNodeCache(std::uint32_t actorFormID);
+
 	// -------------------------
 	// Convenience wrappers
 	// -------------------------
 	// Head
 	inline void SetHeadScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeHead, scale, logOps);
+		SetNodeScale(actor, NodeId::kHead, scale, logOps);
 	}
 
 	inline void SetNeckScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeNeck, scale, logOps);
+		SetNodeScale(actor, NodeId::kNeck, scale, logOps);
 	}
 
 	// Spine
 	inline void SetSpine0Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeSpine0, scale, logOps);
+		SetNodeScale(actor, NodeId::kSpine0, scale, logOps);
 	}
 
 	inline void SetSpine1Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeSpine1, scale, logOps);
+		SetNodeScale(actor, NodeId::kSpine1, scale, logOps);
 	}
 
 	inline void SetSpine2Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeSpine2, scale, logOps);
+		SetNodeScale(actor, NodeId::kSpine2, scale, logOps);
 	}
 
 	inline void SetSpine3Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeSpine3, scale, logOps);
+		SetNodeScale(actor, NodeId::kSpine3, scale, logOps);
 	}
 
 	// Pelvis
 	inline void SetPelvisScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodePelvis, scale, logOps);
+		SetNodeScale(actor, NodeId::kPelvis, scale, logOps);
 	}
 
 	// Arms
 	inline void SetLeftClavicleScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLClavicle, scale, logOps);
+		SetNodeScale(actor, NodeId::kLClavicle, scale, logOps);
 	}
 	inline void SetRightClavicleScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRClavicle, scale, logOps);
+		SetNodeScale(actor, NodeId::kRClavicle, scale, logOps);
 	}
 	inline void SetLeftUpperArmScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLUpperArm, scale, logOps);
+		SetNodeScale(actor, NodeId::kLUpperArm, scale, logOps);
 	}
 	inline void SetRightUpperArmScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRUpperArm, scale, logOps);
+		SetNodeScale(actor, NodeId::kRUpperArm, scale, logOps);
 	}
 	inline void SetLeftForearmScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLForearm, scale, logOps);
+		SetNodeScale(actor, NodeId::kLForearm, scale, logOps);
 	}
 	inline void SetRightForearmScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRForearm, scale, logOps);
+		SetNodeScale(actor, NodeId::kRForearm, scale, logOps);
 	}
 	inline void SetLeftHandScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLHand, scale, logOps);
+		SetNodeScale(actor, NodeId::kLHand, scale, logOps);
 	}
 	inline void SetRightHandScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRHand, scale, logOps);
+		SetNodeScale(actor, NodeId::kRHand, scale, logOps);
 	}
 
 	// Legs
 	inline void SetLeftThighScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLThigh, scale, logOps);
+		SetNodeScale(actor, NodeId::kLThigh, scale, logOps);
 	}
 	inline void SetRightThighScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRThigh, scale, logOps);
+		SetNodeScale(actor, NodeId::kRThigh, scale, logOps);
 	}
 	inline void SetLeftCalfScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLCalf, scale, logOps);
+		SetNodeScale(actor, NodeId::kLCalf, scale, logOps);
 	}
 	inline void SetRightCalfScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRCalf, scale, logOps);
+		SetNodeScale(actor, NodeId::kRCalf, scale, logOps);
 	}
 	inline void SetLeftFootScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLFoot, scale, logOps);
+		SetNodeScale(actor, NodeId::kLFoot, scale, logOps);
 	}
 	inline void SetRightFootScale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRFoot, scale, logOps);
+		SetNodeScale(actor, NodeId::kRFoot, scale, logOps);
 	}
 	inline void SetLeftToe0Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeLToe0, scale, logOps);
+		SetNodeScale(actor, NodeId::kLToe0, scale, logOps);
 	}
 	inline void SetRightToe0Scale(RE::ActorHandle actor, float scale, bool logOps)
 	{
-		SetNodeScale(actor, kNodeRToe0, scale, logOps);
+		SetNodeScale(actor, NodeId::kRToe0, scale, logOps);
 	}
 }
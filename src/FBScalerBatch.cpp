@@ -0,0 +1,81 @@
+#include "FBScaler.h"
+
+#include <algorithm>
+#include <bit>
+
+// Scaler::Batch bookkeeping. Engine-free (handles only): the writes reach the game through
+// PostBatchWrites (FBScaler.cpp), so FullBodiedBench compiles this file as is.
+namespace FB::Scaler
+{
+	Batch::ActorWrites& Batch::GetOrAdd(RE::ActorHandle actor)
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			if (pending[i].actor == actor) {
+				return pending[i];
+			}
+		}
+
+		if (count == pending.size()) {
+			pending.emplace_back();
+		}
+
+		auto& w = pending[count++];
+		w.actor = actor;
+		w.mask = 0;
+		w.logOps = false;
+		return w;
+	}
+
+	void Batch::Set(RE::ActorHandle actor, NodeId id, float scale, bool logOps)
+	{
+		if (!actor) {
+			return;
+		}
+
+		auto& w = GetOrAdd(actor);
+		const auto idx = static_cast<std::size_t>(id);
+
+		// Clamp here so every caller benefits and we keep behavior consistent.
+		w.scales[idx] = std::clamp(scale, 0.0f, 5.0f);
+		w.mask |= 1u << idx;
+		w.logOps = w.logOps || logOps;
+	}
+
+	void Batch::ResetMask(RE::ActorHandle actor, std::uint32_t nodeMask, bool logOps)
+	{
+		if (!actor || nodeMask == 0) {
+			return;
+		}
+
+		auto& w = GetOrAdd(actor);
+		for (auto bits = nodeMask; bits != 0; bits &= bits - 1) {
+			w.scales[static_cast<std::size_t>(std::countr_zero(bits))] = 1.0f;
+		}
+		w.mask |= nodeMask;
+		w.logOps = w.logOps || logOps;
+	}
+
+	std::optional<float> Batch::Peek(RE::ActorHandle actor, NodeId id) const
+	{
+		const auto idx = static_cast<std::size_t>(id);
+		for (std::size_t i = 0; i < count; ++i) {
+			if (pending[i].actor == actor) {
+				if (pending[i].mask & (1u << idx)) {
+					return pending[i].scales[idx];
+				}
+				break;
+			}
+		}
+		return std::nullopt;
+	}
+
+	void Batch::Flush()
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			if (pending[i].mask != 0) {
+				PostBatchWrites(pending[i]);
+			}
+		}
+		count = 0;
+	}
+}
@@ -0,0 +1,95 @@
+#include "FBScheduler.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	std::atomic<std::uint32_t> g_budgetMicros{ 0 };
+
+	// LodSettings, squared / inverted at publish
+	std::atomic<float> g_farDistanceSq{ 0.0f };
+	std::atomic<float> g_cullDistanceSq{ 0.0f };
+	std::atomic<float> g_farInterval{ 0.0f };
+
+	// Game thread only
+	Clock::time_point g_deadline{ Clock::time_point::max() };
+	RE::NiPoint3 g_cameraPos{};
+	bool g_cameraValid{ false };
+
+	static float Squared(float distance)
+	{
+		return distance > 0.0f ? distance * distance : 0.0f;
+	}
+}
+
+namespace FB::Scheduler
+{
+	void SetBudget(std::uint32_t micros)
+	{
+		g_budgetMicros.store(micros, std::memory_order_relaxed);
+	}
+
+	void SetLod(const LodSettings& settings)
+	{
+		g_farDistanceSq.store(Squared(settings.farDistance), std::memory_order_relaxed);
+		g_cullDistanceSq.store(Squared(settings.cullDistance), std::memory_order_relaxed);
+		g_farInterval.store(settings.farUpdateHz > 0.0f ? 1.0f / settings.farUpdateHz : 0.0f, std::memory_order_relaxed);
+	}
+
+	void BeginFrame()
+	{
+		const auto micros = g_budgetMicros.load(std::memory_order_relaxed);
+		g_deadline = micros > 0 ? Clock::now() + std::chrono::microseconds(micros) : Clock::time_point::max();
+
+		// One camera sample per frame; without a camera (menus, loading) distance LOD is off.
+		const auto* camera = RE::PlayerCamera::GetSingleton();
+		g_cameraValid = camera && camera->cameraRoot;
+		if (g_cameraValid) {
+			g_cameraPos = camera->cameraRoot->world.translate;
+		}
+	}
+
+	bool HasBudget()
+	{
+		return g_deadline == Clock::time_point::max() || Clock::now() < g_deadline;
+	}
+
+	bool IsVisible(const RE::Actor* actor)
+	{
+		if (!actor || actor->IsDisabled() || !actor->Is3DLoaded()) {
+			return false;
+		}
+
+		auto* root = actor->Get3D();
+		return root && !root->GetFlags().any(RE::NiAVObject::Flag::kHidden);
+	}
+
+	Lod GetLod(const RE::Actor* actor)
+	{
+		if (!IsVisible(actor)) {
+			return Lod::kCulled;
+		}
+
+		if (!g_cameraValid) {
+			return Lod::kNear;
+		}
+
+		const float distanceSq = (actor->GetPosition() - g_cameraPos).SqrLength();
+
+		const float cullSq = g_cullDistanceSq.load(std::memory_order_relaxed);
+		if (cullSq > 0.0f && distanceSq > cullSq) {
+			return Lod::kCulled;
+		}
+
+		const float farSq = g_farDistanceSq.load(std::memory_order_relaxed);
+		return farSq > 0.0f && distanceSq > farSq ? Lod::kFar : Lod::kNear;
+	}
+
+	float FarUpdateInterval()
+	{
+		return g_farInterval.load(std::memory_order_relaxed);
+	}
+}
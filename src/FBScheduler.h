@@ -0,0 +1,52 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <cstdint>
+
+namespace FB::Scheduler
+{
+	// Per-frame work budget for the update pump ([General] FrameBudgetMicros; 0 = unlimited).
+	// Work is split by priority: timeline commands for visible actors (and tween steps) always run;
+	// off-screen timelines (both actors kCulled: unloaded, disabled, hidden or past cullDistance),
+	// culled actors' final sticky morph values and scale restores for unloaded casters run only while
+	// the frame still has budget left and otherwise spill into later frames.
+	// Effect LOD (GetLod) lowers the step rate of tweens and sticky re-applies on far actors and
+	// skips intermediate steps on culled ones.
+
+	// Effect level of detail for one actor, from its camera distance and culling state.
+	enum class Lod : std::uint8_t
+	{
+		kNear,    // full rate
+		kFar,     // tweens and sticky re-applies step at LodSettings::farUpdateHz
+		kCulled,  // 3D unloaded / hidden / past cullDistance: only final values are written
+	};
+
+	// [General] LodFarDistance / LodFarUpdateHz / LodCullDistance (distances in game units; 0 = off).
+	struct LodSettings
+	{
+		float farDistance{ 2048.0f };
+		float farUpdateHz{ 10.0f };
+		float cullDistance{ 8192.0f };
+	};
+
+	// Any thread (config publish).
+	void SetBudget(std::uint32_t micros);
+	void SetLod(const LodSettings& settings);
+
+	// Open this frame's budget window and sample the camera position for GetLod.
+	// Update pump only, before any per-frame work.
+	void BeginFrame();
+
+	// True while the frame has spent less than its budget (always true when unlimited). Game thread.
+	bool HasBudget();
+
+	// 3D loaded, enabled and not hidden. No distance test; GetLod adds that. Game thread.
+	bool IsVisible(const RE::Actor* actor);
+
+	// Null or invisible actors are kCulled. Game thread.
+	Lod GetLod(const RE::Actor* actor);
+
+	// Seconds between far-LOD steps (0 when far actors run at full rate).
+	float FarUpdateInterval();
+}
@@ -0,0 +1,213 @@
+#include "FBStats.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+#if FB_ENABLE_STATS
+
+namespace
+{
+	constexpr std::size_t kTimerCount = static_cast<std::size_t>(FB::Stats::Timer::kCount);
+	constexpr std::size_t kCounterCount = static_cast<std::size_t>(FB::Stats::Counter::kCount);
+	constexpr std::size_t kGaugeCount = static_cast<std::size_t>(FB::Stats::Gauge::kCount);
+
+	constexpr std::array<std::string_view, kTimerCount> kTimerNames{ "Update", "EventSink", "TargetResolve" };
+	constexpr std::array<std::string_view, kCounterCount> kCounterNames{ "ScaleTasks", "MorphTasks", "HideOps", "PapyrusDispatches",
+		"DeferredTimelines", "DeferredSticky", "DeferredResets" };
+	constexpr std::array<std::string_view, kGaugeCount> kGaugeNames{ "ActiveTimelines", "MorphTweens", "ScaleTweens" };
+
+	// Most recent samples per timer per thread; a summary window that overflows it keeps the newest.
+	constexpr std::uint32_t kReservoirSize = 1024;
+
+	// Written only by its owning thread (relaxed atomics so the summarizer can read without a lock).
+	struct ThreadSlot
+	{
+		struct Reservoir
+		{
+			std::array<std::atomic<std::uint32_t>, kReservoirSize> ticks{};
+			std::atomic<std::uint32_t> written{ 0 };
+
+			// Summarizer-only: value of written at the previous summary
+			std::uint32_t summarized{ 0 };
+		};
+
+		std::array<Reservoir, kTimerCount> timers{};
+		std::array<std::atomic<std::uint64_t>, kCounterCount> counters{};
+
+		// Summarizer-only: counter values at the previous summary
+		std::array<std::uint64_t, kCounterCount> summarizedCounters{};
+	};
+
+	// Slots are never freed: a thread_local pointer to one stays valid for the process lifetime.
+	std::mutex g_slotsMutex;
+	std::vector<std::unique_ptr<ThreadSlot>> g_slots;
+
+	std::array<std::atomic<std::uint64_t>, kGaugeCount> g_gauges{};
+
+	// Summary window; also calibrates TSC ticks against steady_clock.
+	std::mutex g_summaryMutex;
+	std::uint64_t g_windowStartTsc = FB::Stats::Now();
+	std::chrono::steady_clock::time_point g_windowStart = std::chrono::steady_clock::now();
+
+	// Periodic dump
+	std::atomic<std::uint32_t> g_summaryIntervalSeconds{ 0 };
+	std::chrono::steady_clock::time_point g_lastDump = std::chrono::steady_clock::now();  // game thread only
+
+	static ThreadSlot& GetSlot()
+	{
+		thread_local ThreadSlot* t_slot = nullptr;
+		if (!t_slot) {
+			auto slot = std::make_unique<ThreadSlot>();
+			t_slot = slot.get();
+
+			std::lock_guard _{ g_slotsMutex };
+			g_slots.push_back(std::move(slot));
+		}
+		return *t_slot;
+	}
+
+	static std::string FormatMicros(double us)
+	{
+		return us >= 1000.0 ? std::format("{:.2f}ms", us / 1000.0) : std::format("{:.1f}us", us);
+	}
+}
+
+namespace FB::Stats
+{
+	void Record(Timer timer, std::uint64_t ticks)
+	{
+		auto& r = GetSlot().timers[static_cast<std::size_t>(timer)];
+		const auto i = r.written.load(std::memory_order_relaxed);
+		r.ticks[i % kReservoirSize].store(static_cast<std::uint32_t>(std::min<std::uint64_t>(ticks, UINT32_MAX)), std::memory_order_relaxed);
+		r.written.store(i + 1, std::memory_order_release);
+	}
+
+	void Add(Counter counter, std::uint64_t n)
+	{
+		auto& c = GetSlot().counters[static_cast<std::size_t>(counter)];
+		c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+	}
+
+	void Set(Gauge gauge, std::uint64_t value)
+	{
+		g_gauges[static_cast<std::size_t>(gauge)].store(value, std::memory_order_relaxed);
+	}
+
+	void SetSummaryInterval(std::uint32_t seconds)
+	{
+		g_summaryIntervalSeconds.store(seconds, std::memory_order_relaxed);
+	}
+
+	void Tick()
+	{
+		const auto intervalSeconds = g_summaryIntervalSeconds.load(std::memory_order_relaxed);
+		if (intervalSeconds == 0) {
+			return;
+		}
+
+		const auto now = std::chrono::steady_clock::now();
+		if (now - g_lastDump < std::chrono::seconds(intervalSeconds)) {
+			return;
+		}
+		g_lastDump = now;
+
+		for (const auto& line : Summarize()) {
+			spdlog::info("[FB] Stats: {}", line);
+		}
+	}
+
+	std::vector<std::string> Summarize()
+	{
+		std::lock_guard summaryLock{ g_summaryMutex };
+
+		const auto nowTsc = Now();
+		const auto now = std::chrono::steady_clock::now();
+		const double windowUs = std::chrono::duration<double, std::micro>(now - g_windowStart).count();
+		const double ticksPerUs = windowUs > 0.0 ? static_cast<double>(nowTsc - g_windowStartTsc) / windowUs : 1.0;
+		const double windowSeconds = windowUs / 1'000'000.0;
+
+		std::array<std::vector<std::uint32_t>, kTimerCount> samples;
+		std::array<std::uint64_t, kCounterCount> counts{};
+
+		{
+			std::lock_guard slotsLock{ g_slotsMutex };
+			for (auto& slot : g_slots) {
+				for (std::size_t t = 0; t < kTimerCount; ++t) {
+					auto& r = slot->timers[t];
+					const auto written = r.written.load(std::memory_order_acquire);
+					const auto fresh = std::min<std::uint32_t>(written - r.summarized, kReservoirSize);
+					for (std::uint32_t i = written - fresh; i != written; ++i) {
+						samples[t].push_back(r.ticks[i % kReservoirSize].load(std::memory_order_relaxed));
+					}
+					r.summarized = written;
+				}
+
+				for (std::size_t c = 0; c < kCounterCount; ++c) {
+					const auto value = slot->counters[c].load(std::memory_order_relaxed);
+					counts[c] += value - slot->summarizedCounters[c];
+					slot->summarizedCounters[c] = value;
+				}
+			}
+		}
+
+		std::vector<std::string> out;
+		out.push_back(std::format("window={:.1f}s", windowSeconds));
+
+		for (std::size_t t = 0; t < kTimerCount; ++t) {
+			auto& v = samples[t];
+			if (v.empty()) {
+				out.push_back(std::format("{}: no samples", kTimerNames[t]));
+				continue;
+			}
+
+			const auto pct = [&](double p) {
+				const auto k = static_cast<std::size_t>(p * static_cast<double>(v.size() - 1));
+				std::nth_element(v.begin(), v.begin() + k, v.end());
+				return static_cast<double>(v[k]) / ticksPerUs;
+			};
+
+			const double p50 = pct(0.50);
+			const double p99 = pct(0.99);
+			const double max = static_cast<double>(*std::max_element(v.begin(), v.end())) / ticksPerUs;
+			out.push_back(std::format("{}: n={} p50={} p99={} max={}",
+				kTimerNames[t], v.size(), FormatMicros(p50), FormatMicros(p99), FormatMicros(max)));
+		}
+
+		std::string rates;
+		for (std::size_t c = 0; c < kCounterCount; ++c) {
+			rates += std::format("{}{}={:.1f}/s", c ? " " : "", kCounterNames[c],
+				windowSeconds > 0.0 ? static_cast<double>(counts[c]) / windowSeconds : 0.0);
+		}
+		out.push_back(std::move(rates));
+
+		std::string gauges;
+		for (std::size_t g = 0; g < kGaugeCount; ++g) {
+			gauges += std::format("{}{}={}", g ? " " : "", kGaugeNames[g], g_gauges[g].load(std::memory_order_relaxed));
+		}
+		out.push_back(std::move(gauges));
+
+		g_windowStartTsc = nowTsc;
+		g_windowStart = now;
+		return out;
+	}
+}
+
+#else
+
+namespace FB::Stats
+{
+	std::vector<std::string> Summarize()
+	{
+		return { "instrumentation compiled out (FB_ENABLE_STATS=0)" };
+	}
+}
+
+#endif
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Hot-path instrumentation. Build with FB_ENABLE_STATS=0 (CMake option FB_ENABLE_STATS) and every
+// FB_STATS_* macro below expands to nothing; no timers, counters or TSC reads are left in the binary.
+#ifndef FB_ENABLE_STATS
+#	define FB_ENABLE_STATS 1
+#endif
+
+#if FB_ENABLE_STATS
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	else
+#		include <x86intrin.h>
+#	endif
+#endif
+
+namespace FB::Stats
+{
+	// Scoped-timer metrics (p50/p99 per summary window)
+	enum class Timer : std::uint8_t
+	{
+		kUpdate,         // ActorManager::Update
+		kEventSink,      // AnimationEventSink::ProcessEvent
+		kTargetResolve,  // FindLikelyPairedTarget
+
+		kCount
+	};
+
+	// Monotonic counters (reported as per-second rates)
+	enum class Counter : std::uint8_t
+	{
+		kScaleTasks,          // SKSE tasks posted by FBScaler
+		kMorphTasks,          // SKSE tasks posted by FBMorph
+		kHideOps,             // FBHide hide/slot/reset operations (run inline; no task)
+		kPapyrusDispatches,   // DispatchStaticCall into FBMorphBridge
+		kDeferredTimelines,   // off-screen timelines whose due commands waited a frame (frame budget)
+		kDeferredSticky,      // culled actors' final sticky values that waited a frame
+		kDeferredResets,      // unloaded-caster scale restores still queued at the end of a frame
+
+		kCount
+	};
+
+	// Last-value gauges, sampled by the owner once per tick
+	enum class Gauge : std::uint8_t
+	{
+		kActiveTimelines,
+		kMorphTweens,
+		kScaleTweens,
+
+		kCount
+	};
+
+#if FB_ENABLE_STATS
+	void Record(Timer timer, std::uint64_t ticks);
+	void Add(Counter counter, std::uint64_t n = 1);
+	void Set(Gauge gauge, std::uint64_t value);
+
+	inline std::uint64_t Now() noexcept { return __rdtsc(); }
+
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(Timer timer) noexcept :
+			_timer(timer), _start(Now()) {}
+
+		~ScopedTimer() { Record(_timer, Now() - _start); }
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		Timer _timer;
+		std::uint64_t _start;
+	};
+
+	// Periodic log dump interval ([Debug] iStatsLogSeconds; 0 = never). Any thread.
+	void SetSummaryInterval(std::uint32_t seconds);
+
+	// Log a summary when the interval has elapsed. Game thread; called from the update pump.
+	void Tick();
+#endif
+
+	// Human-readable summary of the window since the last summary (one line per entry).
+	// Starts a new window. Used by the periodic log dump and the console command.
+	std::vector<std::string> Summarize();
+}
+
+#if FB_ENABLE_STATS
+#	define FB_STATS_CONCAT_INNER(a, b) a##b
+#	define FB_STATS_CONCAT(a, b) FB_STATS_CONCAT_INNER(a, b)
+#	define FB_STATS_TIMER(timer) const FB::Stats::ScopedTimer FB_STATS_CONCAT(fbStatsTimer_, __LINE__){ FB::Stats::Timer::timer }
+#	define FB_STATS_ADD(counter, n) FB::Stats::Add(FB::Stats::Counter::counter, (n))
+#	define FB_STATS_SET(gauge, v) FB::Stats::Set(FB::Stats::Gauge::gauge, (v))
+#	define FB_STATS_TICK() FB::Stats::Tick()
+#	define FB_STATS_SET_INTERVAL(seconds) FB::Stats::SetSummaryInterval(seconds)
+#else
+#	define FB_STATS_TIMER(timer) ((void)0)
+#	define FB_STATS_ADD(counter, n) ((void)0)
+#	define FB_STATS_SET(gauge, v) ((void)0)
+#	define FB_STATS_TICK() ((void)0)
+#	define FB_STATS_SET_INTERVAL(seconds) ((void)0)
+#endif
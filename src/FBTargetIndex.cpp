@@ -0,0 +1,198 @@
+#include "FBTargetIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	// Bucket edge in game units. Paired-idle partners stand well inside one bucket (search radius ~250),
+	// and the 3x3 neighbourhood absorbs the drift of actors that moved since their last refresh.
+	constexpr float kBucketSize = 512.0f;
+
+	// High actors re-bucketed per Refresh() call; a crowded city (~200 high actors) is swept in a few frames.
+	constexpr std::size_t kRefreshPerFrame = 32;
+
+	struct BucketKey
+	{
+		const RE::TESObjectCELL* cell{ nullptr };
+		std::int32_t x{ 0 };
+		std::int32_t y{ 0 };
+
+		bool operator==(const BucketKey&) const = default;
+	};
+
+	struct BucketKeyHash
+	{
+		std::size_t operator()(const BucketKey& k) const noexcept
+		{
+			std::size_t h = std::hash<const void*>{}(k.cell);
+			h ^= static_cast<std::size_t>(static_cast<std::uint32_t>(k.x)) * 73856093u;
+			h ^= static_cast<std::size_t>(static_cast<std::uint32_t>(k.y)) * 19349663u;
+			return h;
+		}
+	};
+
+	struct Member
+	{
+		std::uint32_t formID{ 0 };
+		RE::ActorHandle handle;
+	};
+
+	struct Entry
+	{
+		BucketKey bucket;
+		std::uint32_t sweep{ 0 };
+	};
+
+	// Writers: Refresh/Clear (game thread). Readers: Query (animation event threads).
+	std::shared_mutex g_indexMutex;
+	std::unordered_map<std::uint32_t, Entry> g_entries;
+	std::unordered_map<BucketKey, std::vector<Member>, BucketKeyHash> g_buckets;
+
+	// Sweep state (game thread only, but kept under the lock with the data it describes)
+	std::size_t g_cursor = 0;
+	std::uint32_t g_sweep = 1;
+
+	// Set once a full sweep completed; before that Query reports "not ready" and callers fall back to a scan.
+	std::atomic_bool g_ready{ false };
+
+	static std::int32_t BucketCoord(float v)
+	{
+		return static_cast<std::int32_t>(std::floor(v / kBucketSize));
+	}
+
+	static BucketKey MakeKey(const RE::TESObjectCELL* cell, const RE::NiPoint3& pos)
+	{
+		return { cell, BucketCoord(pos.x), BucketCoord(pos.y) };
+	}
+
+	// Caller holds g_indexMutex exclusively
+	static void RemoveFromBucketLocked(const BucketKey& key, std::uint32_t formID)
+	{
+		auto it = g_buckets.find(key);
+		if (it == g_buckets.end()) {
+			return;
+		}
+
+		auto& members = it->second;
+		for (std::size_t i = 0; i < members.size(); ++i) {
+			if (members[i].formID == formID) {
+				members[i] = members.back();
+				members.pop_back();
+				break;
+			}
+		}
+
+		if (members.empty()) {
+			g_buckets.erase(it);
+		}
+	}
+
+	static void UpdateEntryLocked(RE::Actor& actor)
+	{
+		const auto formID = actor.GetFormID();
+		const auto key = MakeKey(actor.GetParentCell(), actor.GetPosition());
+
+		auto [it, inserted] = g_entries.try_emplace(formID);
+		auto& e = it->second;
+		e.sweep = g_sweep;
+
+		if (!inserted) {
+			if (e.bucket == key) {
+				return;
+			}
+			RemoveFromBucketLocked(e.bucket, formID);
+		}
+
+		e.bucket = key;
+		g_buckets[key].push_back({ formID, actor.CreateRefHandle() });
+	}
+
+	// Drop actors that left the high process list (or unloaded) during the sweep that just finished.
+	static void EndSweepLocked()
+	{
+		for (auto it = g_entries.begin(); it != g_entries.end(); ) {
+			if (it->second.sweep != g_sweep) {
+				RemoveFromBucketLocked(it->second.bucket, it->first);
+				it = g_entries.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+
+		++g_sweep;
+		g_cursor = 0;
+		g_ready.store(true, std::memory_order_release);
+	}
+}
+
+namespace FB::TargetIndex
+{
+	void Refresh()
+	{
+		auto* processLists = RE::ProcessLists::GetSingleton();
+		if (!processLists) {
+			return;
+		}
+
+		const auto& handles = processLists->highActorHandles;
+		const std::size_t total = handles.size();
+
+		std::unique_lock lock{ g_indexMutex };
+
+		for (std::size_t n = 0; n < kRefreshPerFrame && g_cursor < total; ++n) {
+			auto actor = handles[g_cursor++].get();
+			if (!actor || actor->IsDead() || !actor->Is3DLoaded()) {
+				continue;
+			}
+			UpdateEntryLocked(*actor);
+		}
+
+		if (g_cursor >= total) {
+			EndSweepLocked();
+		}
+	}
+
+	bool Query(const RE::TESObjectCELL* cell, const RE::NiPoint3& pos, float radius, std::vector<RE::ActorHandle>& out)
+	{
+		if (!g_ready.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		const auto center = MakeKey(cell, pos);
+		const auto span = std::max<std::int32_t>(1, static_cast<std::int32_t>(std::ceil(radius / kBucketSize)));
+
+		std::shared_lock lock{ g_indexMutex };
+
+		for (std::int32_t dy = -span; dy <= span; ++dy) {
+			for (std::int32_t dx = -span; dx <= span; ++dx) {
+				const auto it = g_buckets.find(BucketKey{ cell, center.x + dx, center.y + dy });
+				if (it == g_buckets.end()) {
+					continue;
+				}
+				for (const auto& m : it->second) {
+					out.push_back(m.handle);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void Clear()
+	{
+		std::unique_lock lock{ g_indexMutex };
+		g_entries.clear();
+		g_buckets.clear();
+		g_cursor = 0;
+		g_ready.store(false, std::memory_order_release);
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace FB::TargetIndex
+{
+	// Cell-bucketed spatial index over high-process actors, used by target resolution so a start
+	// event only looks at actors near the caster instead of every high actor.
+	// Membership is refreshed incrementally from the update pump: a bounded slice of actors per frame.
+
+	// Re-bucket the next slice of high actors and drop actors not seen for a full sweep. Game thread only.
+	void Refresh();
+
+	// Append actors bucketed within roughly radius of pos in cell to out (positions are from their
+	// last refresh; callers re-check the live distance). Safe from any thread.
+	// Returns false if the index has not completed its first sweep yet and cannot be trusted.
+	bool Query(const RE::TESObjectCELL* cell, const RE::NiPoint3& pos, float radius, std::vector<RE::ActorHandle>& out);
+
+	// Forget everything (e.g. on save load; the next sweeps rebuild it).
+	void Clear();
+}
@@ -1,7 +1,11 @@
 #include "FBUpdatePump.h"
 
 #include "ActorManager.h"
-#include "AnimationEvents.h"  // RegisterAnimationEventSink
+#include "AnimationEvents.h"  // RegisterAnimationEventSink / RetryPendingAnimationEventSinks
+#include "FBFrameClock.h"
+#include "FBScheduler.h"
+#include "FBStats.h"
+#include "FBTargetIndex.h"
 
 #include "RE/Skyrim.h"
 #include "REL/Relocation.h"
@@ -27,6 +31,11 @@ namespace
 	// Pathological dt clamp (keeps timelines sane through hitches/loading).
 	constexpr float kMaxDtSeconds = 0.25f;
 
+	// Time cut off by the clamp is paid back over the next frames, so a hitch delays effects rather
+	// than dropping time. Bounded: a loading screen must not fast-forward timelines for seconds after.
+	constexpr float kMaxCarrySeconds = 1.0f;
+	float g_carrySeconds = 0.0f;  // game thread only
+
 	struct PlayerUpdateHook
 	{
 		// Canonical vfunc index (your established value).
@@ -50,15 +59,32 @@ namespace
 				}
 			}
 
+			// NPCs whose 3D loaded before their graphs did (see InstallActorLoadSink).
+			RetryPendingAnimationEventSinks();
+
 			// Safety gates.
 			if (a_delta <= 0.0f) {
 				return;
 			}
 
-			// Clamp dt defensively.
-			const float dt = std::min(a_delta, kMaxDtSeconds);
+			// Clamp dt defensively, carrying the remainder forward.
+			const float owed = a_delta + g_carrySeconds;
+			const float dt = std::min(owed, kMaxDtSeconds);
+			g_carrySeconds = std::min(owed - dt, kMaxCarrySeconds);
+
+			// Game clock first: everything below (and every event sink until the next frame) sees this frame's time.
+			FB::FrameClock::Advance(dt);
+
+			// Frame budget window for everything the runtime may defer ([General] FrameBudgetMicros).
+			FB::Scheduler::BeginFrame();
 
 			FB::ActorManager::Update(dt);
+
+			// Keep the target-resolution index fresh: one bounded slice of high actors per frame.
+			FB::TargetIndex::Refresh();
+
+			// Periodic [FB] Stats log dump ([Debug] iStatsLogSeconds).
+			FB_STATS_TICK();
 		}
 
 		static inline REL::Relocation<decltype(thunk)> func;
@@ -2,11 +2,18 @@
 
 #include <memory>
 
-#include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/spdlog.h>
 
 
+#include "ActorManager.h"
 #include "AnimationEvents.h"
+#include "FBActorRegistry.h"
+#include "FBConfig.h"
+#include "FBConsole.h"
+#include "FBHide.h"
+#include "FBLog.h"
+#include "FBMorph.h"
+#include "FBTargetIndex.h"
 #include "FBUpdatePump.h"
 
 #include "RE/Skyrim.h"
@@ -25,13 +32,8 @@ namespace
 
 		*path /= "FullBodiedPlugin.log";
 
-		auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path->string(), true);
-		auto logger = std::make_shared<spdlog::logger>("global", sink);
-
-		spdlog::set_default_logger(std::move(logger));
-		spdlog::set_level(spdlog::level::info);
-		spdlog::set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%l] %v");
-		spdlog::flush_on(spdlog::level::info);
+		// Synchronous until the INI is loaded; [Debug] bAsyncLog then switches the pipeline (see FB::Log).
+		FB::Log::Init(*path);
 
 		spdlog::info("Logging initialized: {}", path->string());
 	}
@@ -74,17 +76,35 @@ SKSEPluginLoad(const SKSE::LoadInterface* skse)
 			}
 
 			switch (msg->type) {
+			case SKSE::MessagingInterface::kPostPostLoad:
+				// RaceMenu answers interface requests once every plugin has loaded.
+				FB::Morph::RequestNativeInterface();
+				break;
 			case SKSE::MessagingInterface::kDataLoaded:
+				// Load config up front so the event filter is published before the first animation event.
+				LoadFBConfig();
+				FB::Config::WarmTimelinesAsync();
 				RegisterSinksToPlayer();
+				InstallActorLoadSink();
+				FB::Console::Install();
 				FB::UpdatePump::Install();
 				FB::UpdatePump::Start();
 				break;
 			case SKSE::MessagingInterface::kNewGame:
 			case SKSE::MessagingInterface::kPostLoadGame:
-
-
-
-
+				// Handles from the previous session are stale; the pump rebuilds the index within a few frames.
+				FB::TargetIndex::Clear();
+
+				// Same for per-actor state: drop what the previous session was running (its slot indices are
+				// about to be reissued), then reclaim every slot.
+				FB::ActorManager::ForgetAll();
+				FB::Hide::ForgetAll();
+				FB::Morph::ForgetAll();
+				FB::ActorRegistry::Clear();
+
+				// Actors already loaded with the save raise no load events; pick them up once here.
+				RegisterLoadedActors();
+				break;
 			default:
 				break;
 			}
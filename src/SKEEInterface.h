@@ -0,0 +1,114 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// RaceMenu (skee64.dll) native plugin interfaces, declared to match its public IPluginInterface ABI.
+// Obtained at runtime through SKSE messaging (see InterfaceExchangeMessage); nothing here links against skee.
+// Only the vtable layout matters: do not reorder or remove members.
+namespace SKEE
+{
+	class IPluginInterface
+	{
+	public:
+		IPluginInterface() = default;
+		virtual ~IPluginInterface() = default;
+
+		virtual std::uint32_t GetVersion() = 0;
+		virtual void Revert() = 0;
+	};
+
+	class IInterfaceMap
+	{
+	public:
+		virtual IPluginInterface* QueryInterface(const char* name) = 0;
+		virtual bool AddInterface(const char* name, IPluginInterface* pluginInterface) = 0;
+		virtual IPluginInterface* RemoveInterface(const char* name) = 0;
+	};
+
+	// Dispatched to "skee"; RaceMenu fills interfaceMap synchronously from its listener.
+	struct InterfaceExchangeMessage
+	{
+		enum : std::uint32_t
+		{
+			kExchangeInterface = 0x9E3779B9
+		};
+
+		IInterfaceMap* interfaceMap{ nullptr };
+	};
+
+	// "BodyMorph". Game thread only.
+	class IBodyMorphInterface : public IPluginInterface
+	{
+	public:
+		enum
+		{
+			kPluginVersion1 = 1,
+			kPluginVersion2,
+			kPluginVersion3,
+			kPluginVersion4
+		};
+
+		class MorphKeyVisitor
+		{
+		public:
+			virtual void Visit(const char* key, float value) = 0;
+		};
+
+		class StringVisitor
+		{
+		public:
+			virtual void Visit(const char* value) = 0;
+		};
+
+		class ActorVisitor
+		{
+		public:
+			virtual void Visit(RE::TESObjectREFR* refr) = 0;
+		};
+
+		class MorphValueVisitor
+		{
+		public:
+			virtual void Visit(RE::TESObjectREFR* refr, const char* morphName, const char* morphKey, float value) = 0;
+		};
+
+		class MorphVisitor
+		{
+		public:
+			virtual void Visit(RE::TESObjectREFR* refr, const char* morphName) = 0;
+		};
+
+		virtual void SetMorph(RE::TESObjectREFR* actor, const char* morphName, const char* morphKey, float relative) = 0;
+		virtual float GetMorph(RE::TESObjectREFR* actor, const char* morphName, const char* morphKey) = 0;
+		virtual void ClearMorph(RE::TESObjectREFR* actor, const char* morphName, const char* morphKey) = 0;
+
+		virtual float GetBodyMorphs(RE::TESObjectREFR* actor, const char* morphName) = 0;
+		virtual void ClearBodyMorphNames(RE::TESObjectREFR* actor, const char* morphName) = 0;
+
+		virtual void VisitMorphs(RE::TESObjectREFR* actor, MorphVisitor& visitor) = 0;
+		virtual void VisitKeys(RE::TESObjectREFR* actor, const char* name, MorphKeyVisitor& visitor) = 0;
+		virtual void VisitMorphValues(RE::TESObjectREFR* actor, MorphValueVisitor& visitor) = 0;
+
+		virtual void ClearMorphs(RE::TESObjectREFR* actor) = 0;
+
+		virtual void ApplyVertexDiff(RE::TESObjectREFR* refr, RE::NiAVObject* rootNode, bool erase = false) = 0;
+
+		virtual void ApplyBodyMorphs(RE::TESObjectREFR* refr, bool deferUpdate = true) = 0;
+		virtual void UpdateModelWeight(RE::TESObjectREFR* refr, bool immediate = false) = 0;
+
+		virtual void SetCacheLimit(std::size_t limit) = 0;
+		virtual bool HasMorphs(RE::TESObjectREFR* actor) = 0;
+		virtual std::uint32_t EvaluateBodyMorphs(RE::TESObjectREFR* actor) = 0;
+
+		virtual bool HasBodyMorph(RE::TESObjectREFR* actor, const char* morphName, const char* morphKey) = 0;
+		virtual bool HasBodyMorphName(RE::TESObjectREFR* actor, const char* morphName) = 0;
+		virtual bool HasBodyMorphKey(RE::TESObjectREFR* actor, const char* morphKey) = 0;
+		virtual void ClearBodyMorphKeys(RE::TESObjectREFR* actor, const char* morphKey) = 0;
+		virtual void VisitStrings(StringVisitor& visitor) = 0;
+		virtual void VisitActors(ActorVisitor& visitor) = 0;
+		virtual std::size_t ClearMorphCache() = 0;
+	};
+}